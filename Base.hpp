@@ -33,6 +33,11 @@
 #include <Base/Map.hpp>
 #include <Base/MutableMap.hpp>
 #include <Base/String.hpp>
+#include <Base/StringView.hpp>
+#include <Base/StringBuilder.hpp>
+#include <Base/StringSearcher.hpp>
+#include <Base/MultiStringMatcher.hpp>
+#include <Base/StringSortKey.hpp>
 #include <Base/MutableString.hpp>
 #include <Base/Blob.hpp>
 #include <Base/MutableBlob.hpp>
@@ -0,0 +1,214 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/Blob.hpp"
+#include "Base/MutableBlob.hpp"
+#include "Base/String.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace NxA;
+
+static std::vector<byte> benchmarkBytesOfSize(count size)
+{
+    std::vector<byte> result(size);
+    for (count index = 0; index < size; ++index) {
+        result[index] = static_cast<byte>((index * 131) ^ (index >> 8));
+    }
+
+    return result;
+}
+
+// -- A straightforward encoder using std::string, used as a baseline.
+static std::string stdBase64StringFor(const std::vector<byte>& bytes)
+{
+    static const character* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string result;
+    count index = 0;
+    for (; (index + 3) <= bytes.size(); index += 3) {
+        uinteger32 value = (bytes[index] << 16) | (bytes[index + 1] << 8) | bytes[index + 2];
+        result.push_back(alphabet[(value >> 18) & 0x3f]);
+        result.push_back(alphabet[(value >> 12) & 0x3f]);
+        result.push_back(alphabet[(value >> 6) & 0x3f]);
+        result.push_back(alphabet[value & 0x3f]);
+    }
+
+    if (index < bytes.size()) {
+        uinteger32 value = bytes[index] << 16;
+        if ((index + 1) < bytes.size()) {
+            value |= bytes[index + 1] << 8;
+        }
+
+        result.push_back(alphabet[(value >> 18) & 0x3f]);
+        result.push_back(alphabet[(value >> 12) & 0x3f]);
+        result.push_back(((index + 1) < bytes.size()) ? alphabet[(value >> 6) & 0x3f] : '=');
+        result.push_back('=');
+    }
+
+    return result;
+}
+
+static void Base_MutableBlob_AppendMemoryWithSize(benchmark::State& state)
+{
+    auto chunk = benchmarkBytesOfSize(state.range(0));
+
+    for (auto _ : state) {
+        MutableBlob test;
+        for (count index = 0; index < 1024; ++index) {
+            test.appendMemoryWithSize(chunk.data(), chunk.size());
+        }
+
+        benchmark::DoNotOptimize(test.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 1024);
+}
+BENCHMARK(Base_MutableBlob_AppendMemoryWithSize)->Arg(4)->Arg(64)->Arg(4096);
+
+static void Base_MutableBlob_AppendMemoryWithSizeAfterReserve(benchmark::State& state)
+{
+    auto chunk = benchmarkBytesOfSize(state.range(0));
+
+    for (auto _ : state) {
+        MutableBlob test;
+        test.reserve(chunk.size() * 1024);
+        for (count index = 0; index < 1024; ++index) {
+            test.appendMemoryWithSize(chunk.data(), chunk.size());
+        }
+
+        benchmark::DoNotOptimize(test.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 1024);
+}
+BENCHMARK(Base_MutableBlob_AppendMemoryWithSizeAfterReserve)->Arg(4)->Arg(64)->Arg(4096);
+
+static void Base_MutableBlob_StdVectorInsert(benchmark::State& state)
+{
+    auto chunk = benchmarkBytesOfSize(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<byte> test;
+        for (count index = 0; index < 1024; ++index) {
+            test.insert(test.end(), chunk.begin(), chunk.end());
+        }
+
+        benchmark::DoNotOptimize(test.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 1024);
+}
+BENCHMARK(Base_MutableBlob_StdVectorInsert)->Arg(4)->Arg(64)->Arg(4096);
+
+static void Base_Blob_Base64String(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+    auto test = Blob::blobWithMemoryAndSize(bytes.data(), bytes.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.base64String());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_Base64String)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Base_Blob_StdBase64String(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(stdBase64StringFor(bytes));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_StdBase64String)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Base_Blob_BlobWithBase64String(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+    auto test = Blob::blobWithMemoryAndSize(bytes.data(), bytes.size()).base64String();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Blob::blobWithBase64String(test));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_BlobWithBase64String)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Base_Blob_HashFor(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Blob::hashFor(bytes.data(), bytes.size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_HashFor)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Base_Blob_StdHash(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+    std::string test{ bytes.begin(), bytes.end() };
+    std::hash<std::string> hasher;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher(test));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_StdHash)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Base_Blob_Description(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+    auto test = Blob::blobWithMemoryAndSize(bytes.data(), bytes.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.description());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_Description)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Base_Blob_BlobWithHexString(benchmark::State& state)
+{
+    auto bytes = benchmarkBytesOfSize(state.range(0));
+    auto test = Blob::blobWithMemoryAndSize(bytes.data(), bytes.size()).hexString();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Blob::blobWithHexString(test));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_Blob_BlobWithHexString)->RangeMultiplier(16)->Range(64, 1 << 20);
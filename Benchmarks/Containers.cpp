@@ -0,0 +1,275 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/String.hpp"
+#include "Base/Array.hpp"
+#include "Base/MutableArray.hpp"
+#include "Base/MutableMap.hpp"
+#include "Base/MutableSet.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace NxA;
+
+// -- Keys look like the track identifiers used by most collections.
+static std::vector<std::string> benchmarkKeys(count numberOfKeys)
+{
+    std::vector<std::string> result;
+    result.reserve(numberOfKeys);
+
+    for (count index = 0; index < numberOfKeys; ++index) {
+        result.push_back("track-" + std::to_string((index * 7919) % 1000003));
+    }
+
+    return result;
+}
+
+static void Base_MutableArray_Append(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+    MutableArray<String> strings;
+    for (auto&& key : keys) {
+        strings.append(String{ key });
+    }
+
+    for (auto _ : state) {
+        MutableArray<String> test;
+        for (auto&& string : strings) {
+            test.append(string);
+        }
+
+        benchmark::DoNotOptimize(test);
+    }
+}
+BENCHMARK(Base_MutableArray_Append)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableArray_StdVectorPushBack(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<std::string> test;
+        for (auto&& key : keys) {
+            test.push_back(key);
+        }
+
+        benchmark::DoNotOptimize(test);
+    }
+}
+BENCHMARK(Base_MutableArray_StdVectorPushBack)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableArray_Copy(benchmark::State& state)
+{
+    MutableArray<String> test;
+    for (auto&& key : benchmarkKeys(state.range(0))) {
+        test.append(String{ key });
+    }
+
+    for (auto _ : state) {
+        MutableArray<String> copy{ test };
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(Base_MutableArray_Copy)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableArray_StdVectorCopy(benchmark::State& state)
+{
+    auto test = benchmarkKeys(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<std::string> copy{ test };
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(Base_MutableArray_StdVectorCopy)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_Array_Contains(benchmark::State& state)
+{
+    MutableArray<String> strings;
+    for (auto&& key : benchmarkKeys(state.range(0))) {
+        strings.append(String{ key });
+    }
+
+    Array<String> test{ std::move(strings) };
+    String missing{ "track-missing" };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.contains(missing));
+    }
+}
+BENCHMARK(Base_Array_Contains)->Arg(16)->Arg(1024);
+
+static void Base_Array_StdFind(benchmark::State& state)
+{
+    auto test = benchmarkKeys(state.range(0));
+    std::string missing{ "track-missing" };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(test.begin(), test.end(), missing));
+    }
+}
+BENCHMARK(Base_Array_StdFind)->Arg(16)->Arg(1024);
+
+static void Base_MutableMap_SetValueForKey(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+    std::vector<String> strings{ keys.begin(), keys.end() };
+
+    for (auto _ : state) {
+        MutableMap<String, integer> test;
+        integer value = 0;
+        for (auto&& string : strings) {
+            test.setValueForKey(value++, string);
+        }
+
+        benchmark::DoNotOptimize(test);
+    }
+}
+BENCHMARK(Base_MutableMap_SetValueForKey)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableMap_StdMapInsert(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+
+    for (auto _ : state) {
+        std::map<std::string, integer> test;
+        integer value = 0;
+        for (auto&& key : keys) {
+            test[key] = value++;
+        }
+
+        benchmark::DoNotOptimize(test);
+    }
+}
+BENCHMARK(Base_MutableMap_StdMapInsert)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableMap_MaybeValueForKey(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+    std::vector<String> strings{ keys.begin(), keys.end() };
+
+    MutableMap<String, integer> test;
+    integer value = 0;
+    for (auto&& string : strings) {
+        test.setValueForKey(value++, string);
+    }
+
+    for (auto _ : state) {
+        for (auto&& string : strings) {
+            benchmark::DoNotOptimize(test.maybeValueForKey(string));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_MutableMap_MaybeValueForKey)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableMap_StdMapFind(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+
+    std::map<std::string, integer> test;
+    integer value = 0;
+    for (auto&& key : keys) {
+        test[key] = value++;
+    }
+
+    for (auto _ : state) {
+        for (auto&& key : keys) {
+            benchmark::DoNotOptimize(test.find(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_MutableMap_StdMapFind)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableSet_Add(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+    std::vector<String> strings{ keys.begin(), keys.end() };
+
+    for (auto _ : state) {
+        MutableSet<String> test;
+        for (auto&& string : strings) {
+            test.add(string);
+        }
+
+        benchmark::DoNotOptimize(test);
+    }
+}
+BENCHMARK(Base_MutableSet_Add)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableSet_StdSetInsert(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+
+    for (auto _ : state) {
+        std::set<std::string> test;
+        for (auto&& key : keys) {
+            test.insert(key);
+        }
+
+        benchmark::DoNotOptimize(test);
+    }
+}
+BENCHMARK(Base_MutableSet_StdSetInsert)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableSet_Contains(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+    std::vector<String> strings{ keys.begin(), keys.end() };
+
+    MutableSet<String> test;
+    for (auto&& string : strings) {
+        test.add(string);
+    }
+
+    for (auto _ : state) {
+        for (auto&& string : strings) {
+            benchmark::DoNotOptimize(test.contains(string));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_MutableSet_Contains)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void Base_MutableSet_StdSetCount(benchmark::State& state)
+{
+    auto keys = benchmarkKeys(state.range(0));
+    std::set<std::string> test{ keys.begin(), keys.end() };
+
+    for (auto _ : state) {
+        for (auto&& key : keys) {
+            benchmark::DoNotOptimize(test.count(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_MutableSet_StdSetCount)->Arg(16)->Arg(1024)->Arg(65536);
@@ -0,0 +1,76 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/File.hpp"
+#include "Base/Blob.hpp"
+#include "Base/String.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <vector>
+
+using namespace NxA;
+
+static String benchmarkFileOfSize(count size)
+{
+    auto path = File::joinPaths(File::temporaryDirectoryPath(), String::stringWithFormat("BaseBenchmarks-%llu.bin", static_cast<uinteger64>(size)));
+
+    std::vector<byte> bytes(size);
+    for (count index = 0; index < size; ++index) {
+        bytes[index] = static_cast<byte>(index * 131);
+    }
+
+    File::writeBlobToFileAt(Blob::blobWithMemoryAndSize(bytes.data(), bytes.size()), path);
+
+    return path;
+}
+
+static void Base_File_ReadFileAt(benchmark::State& state)
+{
+    auto path = benchmarkFileOfSize(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(File::readFileAt(path));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    File::deleteFileAt(path);
+}
+BENCHMARK(Base_File_ReadFileAt)->Arg(4 * 1024)->Arg(256 * 1024)->Arg(4 * 1024 * 1024);
+
+static void Base_File_StdIfstreamRead(benchmark::State& state)
+{
+    auto path = benchmarkFileOfSize(state.range(0));
+
+    for (auto _ : state) {
+        std::ifstream file(path.asUTF8(), std::ios::in | std::ios::binary | std::ios::ate);
+        std::vector<character> result(static_cast<count>(file.tellg()));
+        file.seekg(0);
+        file.read(result.data(), result.size());
+
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    File::deleteFileAt(path);
+}
+BENCHMARK(Base_File_StdIfstreamRead)->Arg(4 * 1024)->Arg(256 * 1024)->Arg(4 * 1024 * 1024);
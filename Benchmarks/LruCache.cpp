@@ -0,0 +1,162 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/LruCache.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+using namespace NxA;
+
+// -- The usual least-recently-used cache built from std containers, used as a baseline.
+class StdLruCache
+{
+    // -- Private Instance Variables
+    std::list<std::pair<integer64, integer64>> entries;
+    std::unordered_map<integer64, std::list<std::pair<integer64, integer64>>::iterator> entryForKey;
+    count limit;
+
+public:
+    // -- Constructors/Destructors
+    explicit StdLruCache(count withLimit) : limit{ withLimit } { }
+
+    // -- Instance Methods
+    const integer64* find(integer64 key)
+    {
+        auto found = this->entryForKey.find(key);
+        if (found == this->entryForKey.end()) {
+            return nullptr;
+        }
+
+        this->entries.splice(this->entries.begin(), this->entries, found->second);
+        return &found->second->second;
+    }
+
+    void insert(integer64 key, integer64 value)
+    {
+        auto found = this->entryForKey.find(key);
+        if (found != this->entryForKey.end()) {
+            found->second->second = value;
+            this->entries.splice(this->entries.begin(), this->entries, found->second);
+            return;
+        }
+
+        if (this->entries.size() >= this->limit) {
+            this->entryForKey.erase(this->entries.back().first);
+            this->entries.pop_back();
+        }
+
+        this->entries.emplace_front(key, value);
+        this->entryForKey.emplace(key, this->entries.begin());
+    }
+};
+
+static constexpr count benchmarkCacheLimit = 4096;
+
+static void Base_LruCache_FindHit(benchmark::State& state)
+{
+    LruCache<integer64, integer64> test;
+    test.resizeCache(benchmarkCacheLimit);
+    for (integer64 key = 0; key < integer64(benchmarkCacheLimit); ++key) {
+        test.insert(key, key);
+    }
+
+    integer64 key = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.find(key));
+        key = (key + 17) % benchmarkCacheLimit;
+    }
+}
+BENCHMARK(Base_LruCache_FindHit);
+
+static void Base_LruCache_StdLruCacheFindHit(benchmark::State& state)
+{
+    StdLruCache test{ benchmarkCacheLimit };
+    for (integer64 key = 0; key < integer64(benchmarkCacheLimit); ++key) {
+        test.insert(key, key);
+    }
+
+    integer64 key = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.find(key));
+        key = (key + 17) % benchmarkCacheLimit;
+    }
+}
+BENCHMARK(Base_LruCache_StdLruCacheFindHit);
+
+static void Base_LruCache_FindMiss(benchmark::State& state)
+{
+    LruCache<integer64, integer64> test;
+    test.resizeCache(benchmarkCacheLimit);
+    for (integer64 key = 0; key < integer64(benchmarkCacheLimit); ++key) {
+        test.insert(key, key);
+    }
+
+    integer64 key = benchmarkCacheLimit;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.find(key));
+        ++key;
+    }
+}
+BENCHMARK(Base_LruCache_FindMiss);
+
+static void Base_LruCache_StdLruCacheFindMiss(benchmark::State& state)
+{
+    StdLruCache test{ benchmarkCacheLimit };
+    for (integer64 key = 0; key < integer64(benchmarkCacheLimit); ++key) {
+        test.insert(key, key);
+    }
+
+    integer64 key = benchmarkCacheLimit;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.find(key));
+        ++key;
+    }
+}
+BENCHMARK(Base_LruCache_StdLruCacheFindMiss);
+
+static void Base_LruCache_InsertEvictingEntries(benchmark::State& state)
+{
+    LruCache<integer64, integer64> test;
+    test.resizeCache(benchmarkCacheLimit);
+
+    integer64 key = 0;
+    for (auto _ : state) {
+        test.insert(key, key);
+        ++key;
+    }
+}
+BENCHMARK(Base_LruCache_InsertEvictingEntries);
+
+static void Base_LruCache_StdLruCacheInsertEvictingEntries(benchmark::State& state)
+{
+    StdLruCache test{ benchmarkCacheLimit };
+
+    integer64 key = 0;
+    for (auto _ : state) {
+        test.insert(key, key);
+        ++key;
+    }
+}
+BENCHMARK(Base_LruCache_StdLruCacheInsertEvictingEntries);
@@ -0,0 +1,426 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/String.hpp"
+#include "Base/MutableString.hpp"
+#include "Base/Array.hpp"
+#include "Base/MutableArray.hpp"
+#include "Base/MultiStringMatcher.hpp"
+#include "Base/Describe.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace NxA;
+
+static std::string benchmarkStringOfLength(count length)
+{
+    std::string result;
+    result.reserve(length);
+
+    for (count index = 0; index < length; ++index) {
+        result.push_back(static_cast<character>('a' + (index % 26)));
+    }
+
+    return result;
+}
+
+static void Base_String_HashFor(benchmark::State& state)
+{
+    auto test = benchmarkStringOfLength(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(String::hashFor(test.c_str()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_String_HashFor)->RangeMultiplier(4)->Range(4, 4096);
+
+static void Base_String_StdHash(benchmark::State& state)
+{
+    auto test = benchmarkStringOfLength(state.range(0));
+    std::hash<std::string> hasher;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher(test));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_String_StdHash)->RangeMultiplier(4)->Range(4, 4096);
+
+static void Base_String_Hash64For(benchmark::State& state)
+{
+    auto test = benchmarkStringOfLength(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(String::hash64For(test.c_str(), test.length()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_String_Hash64For)->RangeMultiplier(4)->Range(4, 4096);
+
+static void Base_String_StringWithMemoryAndLength(benchmark::State& state)
+{
+    auto test = benchmarkStringOfLength(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(String::stringWithMemoryAndLength(test.data(), test.length()));
+    }
+}
+BENCHMARK(Base_String_StringWithMemoryAndLength)->Arg(8)->Arg(64)->Arg(1024);
+
+static void Base_String_StdStringConstructor(benchmark::State& state)
+{
+    auto test = benchmarkStringOfLength(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::string(test.data(), test.length()));
+    }
+}
+BENCHMARK(Base_String_StdStringConstructor)->Arg(8)->Arg(64)->Arg(1024);
+
+static void Base_String_Copy(benchmark::State& state)
+{
+    String test{ benchmarkStringOfLength(state.range(0)) };
+
+    for (auto _ : state) {
+        String copy{ test };
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(Base_String_Copy)->Arg(8)->Arg(64)->Arg(1024);
+
+static void Base_String_StdStringCopy(benchmark::State& state)
+{
+    auto test = benchmarkStringOfLength(state.range(0));
+
+    for (auto _ : state) {
+        std::string copy{ test };
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(Base_String_StdStringCopy)->Arg(8)->Arg(64)->Arg(1024);
+
+static void Base_String_Compare(benchmark::State& state)
+{
+    // -- Both strings only differ by their last character, which is the worst case.
+    auto text = benchmarkStringOfLength(state.range(0));
+    String test{ text + "a" };
+    String other{ text + "b" };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.compare(other));
+    }
+}
+BENCHMARK(Base_String_Compare)->Arg(8)->Arg(64)->Arg(1024);
+
+static void Base_String_StdStringCompare(benchmark::State& state)
+{
+    auto text = benchmarkStringOfLength(state.range(0));
+    auto test = text + "a";
+    auto other = text + "b";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.compare(other));
+    }
+}
+BENCHMARK(Base_String_StdStringCompare)->Arg(8)->Arg(64)->Arg(1024);
+
+static String benchmarkMetadataLine()
+{
+    return String("Artist Name;Track Title (Extended Mix);Album;Electronic;128;Am;2017;Label Name;Catalog 001;Comment");
+}
+
+static void Base_String_SplitBySeparator(benchmark::State& state)
+{
+    auto test = benchmarkMetadataLine();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.splitBySeparator(';'));
+    }
+}
+BENCHMARK(Base_String_SplitBySeparator);
+
+static void Base_String_SplitViewsBySeparator(benchmark::State& state)
+{
+    auto test = benchmarkMetadataLine();
+
+    for (auto _ : state) {
+        for (auto&& part : test.splitViewsBySeparator(';')) {
+            benchmark::DoNotOptimize(part.data());
+        }
+    }
+}
+BENCHMARK(Base_String_SplitViewsBySeparator);
+
+static void Base_String_StdStringSplit(benchmark::State& state)
+{
+    auto test = benchmarkMetadataLine().asStdString();
+
+    for (auto _ : state) {
+        std::vector<std::string> parts;
+        std::string::size_type start = 0;
+        for (auto end = test.find(';'); end != std::string::npos; end = test.find(';', start)) {
+            parts.emplace_back(test, start, end - start);
+            start = end + 1;
+        }
+
+        parts.emplace_back(test, start);
+        benchmark::DoNotOptimize(parts);
+    }
+}
+BENCHMARK(Base_String_StdStringSplit);
+
+static void Base_String_LowerCaseString(benchmark::State& state)
+{
+    auto test = benchmarkMetadataLine().upperCaseString();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.lowerCaseString());
+    }
+}
+BENCHMARK(Base_String_LowerCaseString);
+
+static void Base_String_CompareCaseInsensitive(benchmark::State& state)
+{
+    auto test = benchmarkMetadataLine();
+    auto other = test.upperCaseString();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.compareCaseInsensitive(other));
+    }
+}
+BENCHMARK(Base_String_CompareCaseInsensitive);
+
+static void Base_String_CompareCaseInsensitiveSortKeys(benchmark::State& state)
+{
+    auto test = benchmarkMetadataLine().caseInsensitiveSortKey();
+    auto other = benchmarkMetadataLine().upperCaseString().caseInsensitiveSortKey();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.compare(other));
+    }
+}
+BENCHMARK(Base_String_CompareCaseInsensitiveSortKeys);
+
+static std::string benchmarkTextOfLength(count length)
+{
+    static const character* words[] = { "Artist", "Name", "Track", "Title", "Extended", "Mix", "Original", "Remix", "Album", "Label" };
+
+    std::string result;
+    for (count index = 0; result.length() < length; ++index) {
+        result.append(words[(index * 7) % 10]);
+        result.push_back(' ');
+    }
+
+    result.resize(length);
+    return result;
+}
+
+static void Base_String_IndexOfFirstOccurenceOf(benchmark::State& state)
+{
+    auto test = String(benchmarkTextOfLength(state.range(0)) + "Needle");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.indexOfFirstOccurenceOf("Needle"));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_String_IndexOfFirstOccurenceOf)->RangeMultiplier(8)->Range(64, 32768);
+
+static void Base_String_StdStringFind(benchmark::State& state)
+{
+    auto test = benchmarkTextOfLength(state.range(0)) + "Needle";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.find("Needle"));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base_String_StdStringFind)->RangeMultiplier(8)->Range(64, 32768);
+
+static Array<String> benchmarkKeywords()
+{
+    // -- None of these are found in the metadata line, which is the worst case when looking for each one in turn.
+    auto letters = benchmarkStringOfLength(40);
+
+    MutableArray<String> keywords;
+    for (count index = 0; index < 300; ++index) {
+        keywords.append(String(letters.substr(index % 26, 4 + (index % 8)) + std::to_string(index)));
+    }
+
+    return { std::move(keywords) };
+}
+
+static void Base_String_ContainsForEachKeyword(benchmark::State& state)
+{
+    auto keywords = benchmarkKeywords();
+    auto test = benchmarkMetadataLine();
+
+    for (auto _ : state) {
+        boolean found = false;
+        for (auto&& keyword : keywords) {
+            if (test.contains(keyword)) {
+                found = true;
+                break;
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+}
+BENCHMARK(Base_String_ContainsForEachKeyword);
+
+static void Base_MultiStringMatcher_HasMatchIn(benchmark::State& state)
+{
+    MultiStringMatcher matcher{ benchmarkKeywords() };
+    auto test = benchmarkMetadataLine();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matcher.hasMatchIn(test));
+    }
+}
+BENCHMARK(Base_MultiStringMatcher_HasMatchIn);
+
+static void Base_String_StringWithFormat(benchmark::State& state)
+{
+    auto title = benchmarkMetadataLine();
+    Optional<String> artist{ String("Artist") };
+    decimal3 rating{ "1.25" };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(String::stringWithFormat("%s - %s [%d] %02x %s", title, artist, 42, 7, rating));
+    }
+}
+BENCHMARK(Base_String_StringWithFormat);
+
+static void Base_String_StdSnprintf(benchmark::State& state)
+{
+    auto title = benchmarkMetadataLine().asStdString();
+    std::string artist{ "Artist" };
+
+    for (auto _ : state) {
+        character buffer[256];
+        ::snprintf(buffer, sizeof(buffer), "%s - %s [%d] %02x %s", title.c_str(), artist.c_str(), 42, 7, "1.250");
+        benchmark::DoNotOptimize(std::string(buffer));
+    }
+}
+BENCHMARK(Base_String_StdSnprintf);
+
+static void Base_MutableString_AppendStringWithFormat(benchmark::State& state)
+{
+    for (auto _ : state) {
+        MutableString result;
+        for (integer index = 0; index < 64; ++index) {
+            result.appendStringWithFormat("<item index=\"%d\">%s</item>\n", index, "value");
+        }
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(Base_MutableString_AppendStringWithFormat);
+
+static void Base_String_DescribeNestedArrays(benchmark::State& state)
+{
+    MutableArray<MutableArray<String>> test;
+    for (integer outerIndex = 0; outerIndex < 100; ++outerIndex) {
+        MutableArray<String> inner;
+        for (integer innerIndex = 0; innerIndex < 100; ++innerIndex) {
+            inner.append(benchmarkMetadataLine());
+        }
+
+        test.append(inner);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(describe(test));
+    }
+}
+BENCHMARK(Base_String_DescribeNestedArrays);
+
+static void Base_String_StringByJoiningArrayWithString(benchmark::State& state)
+{
+    MutableArray<String> paths;
+    for (integer index = 0; index < state.range(0); ++index) {
+        paths.append(String::stringWithFormat("/Users/someone/Music/Artist %d/Album %d/Track %d.mp3", index % 97, index % 13, index));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(String::stringByJoiningArrayWithString(paths, String("\n")));
+    }
+}
+BENCHMARK(Base_String_StringByJoiningArrayWithString)->Arg(1000)->Arg(100000);
+
+static void Base_String_AsUTF16(benchmark::State& state)
+{
+    MutableString test;
+    for (integer index = 0; index < 100; ++index) {
+        test.append(benchmarkMetadataLine());
+        test.append("Beyonc\xc3\xa9 \xe6\x97\xa5\xe6\x9c\xac ");
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(test.asUTF16());
+    }
+}
+BENCHMARK(Base_String_AsUTF16);
+
+static void Base_String_StringWithUTF16(benchmark::State& state)
+{
+    MutableString text;
+    for (integer index = 0; index < 100; ++index) {
+        text.append(benchmarkMetadataLine());
+        text.append("Beyonc\xc3\xa9 \xe6\x97\xa5\xe6\x9c\xac ");
+    }
+
+    auto test = text.asUTF16();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(String::stringWithUTF16(test));
+    }
+}
+BENCHMARK(Base_String_StringWithUTF16);
+
+static void Base_String_StringWithUTF8NeedsNormalizing(benchmark::State& state)
+{
+    const character* paths[] = {
+        "/Users/someone/Music/Daft Punk/Random Access Memories/Get Lucky.mp3",
+        "/Users/someone/Music/Beyonc\xc3\xa9/D\xc3\xa9j\xc3\xa0 Vu (Extended Mix).mp3",
+        "/Users/someone/Music/Beyonce\xcc\x81/De\xcc\x81ja\xcc\x80 Vu (Extended Mix).mp3",
+        "/Users/someone/Music/Sigur R\xc3\xb3s/\xc3\x81g\xc3\xa6tis byrjun/Sv\xc3\xa1" "fnir.mp3",
+    };
+
+    for (auto _ : state) {
+        for (auto&& path : paths) {
+            benchmark::DoNotOptimize(String::stringWithUTF8(path, String::UTF8Flag::NeedsNormalizing));
+        }
+    }
+}
+BENCHMARK(Base_String_StringWithUTF8NeedsNormalizing);
@@ -46,6 +46,11 @@ Blob Blob::blobWithBase64String(const String& string)
     return {Internal::blobWithBase64String(string)};
 }
 
+Blob Blob::blobWithHexString(const String& string)
+{
+    return {Internal::blobWithHexString(string)};
+}
+
 Blob Blob::blobWithStringWithTerminator(const String& string)
 {
     return {Internal::blobWithStringWithTerminator(string)};
@@ -68,6 +73,11 @@ String Blob::base64StringFor(const byte* memory, count size)
     return {Internal::base64StringFor(memory, size)};
 }
 
+String Blob::hexStringFor(const byte* memory, count size)
+{
+    return {Internal::hexStringFor(memory, size)};
+}
+
 // -- Constructors/Destructors
 
 Blob::Blob() : std::shared_ptr<Internal>{ std::make_shared<Internal>() } { }
@@ -107,6 +117,11 @@ String Blob::base64String() const
     return nxa_internal->base64String();
 }
 
+String Blob::hexString() const
+{
+    return nxa_internal->hexString();
+}
+
 String Blob::description(const DescriberState& state) const
 {
     return nxa_internal->description();
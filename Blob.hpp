@@ -51,12 +51,14 @@ public:
     // -- Factory Methods
     static Blob blobWithMemoryAndSize(const byte*, count);
     static Blob blobWithBase64String(const String&);
+    static Blob blobWithHexString(const String&);
     static Blob blobWithStringWithTerminator(const String&);
     static Blob blobWithStringWithoutTerminator(const String&);
 
     // -- Class Methods
     static Blob hashFor(const byte*, count);
     static String base64StringFor(const byte*, count);
+    static String hexStringFor(const byte*, count);
 
     // -- Operators
     const byte& operator[](count) const;
@@ -78,6 +80,7 @@ public:
 
     Blob hash();
     String base64String() const;
+    String hexString() const;
 };
 
 }
@@ -0,0 +1,235 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Assert.hpp>
+#include <Base/Optional.hpp>
+#include <Base/Uncopyable.hpp>
+#include <Base/LruCache.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace NxA {
+
+// -- Thread-safe least-recently-used cache. Keys are spread across a number of shards, each one being a
+// -- regular LruCache protected by its own mutex, so threads only contend when they hit the same shard.
+// -- Recency is tracked per shard, which approximates a global LRU order when keys are evenly spread.
+template <typename K, typename V, typename Policy = LruEvictionPolicy>
+class ConcurrentLruCache : private Uncopyable
+{
+    // -- Private Types
+    struct alignas(64) Shard
+    {
+        std::mutex lock;
+        LruCache<K, V, Policy> cache;
+    };
+
+    // -- Private Instance Variables
+    std::unique_ptr<Shard[]> shards;
+    count numberOfShards;
+
+    // -- Private Class Methods
+    static count defaultNumberOfShards()
+    {
+        // -- A few shards per core keeps the odds of two threads hitting the same lock low.
+        count wantedNumberOfShards = std::max(std::thread::hardware_concurrency(), 1u) * 4;
+
+        count numberOfShards = 1;
+        while (numberOfShards < wantedNumberOfShards) {
+            numberOfShards *= 2;
+        }
+
+        return numberOfShards;
+    }
+
+    // -- Private Instance Methods
+    Shard& shardForKey(const K& key) const
+    {
+        // -- LruCache picks slots with the low bits of the hash so we use the high ones to pick a shard.
+        auto hash = LruCache<K, V, Policy>::hashFor(key);
+        return this->shards[(hash >> 32) & (this->numberOfShards - 1)];
+    }
+
+public:
+    // -- Types
+    using key_type = K;
+    using value_type = V;
+
+    // -- Constructors/Destructors
+    ConcurrentLruCache() : ConcurrentLruCache{ ConcurrentLruCache::defaultNumberOfShards() } { }
+    explicit ConcurrentLruCache(count withNumberOfShards)
+        : shards{ std::make_unique<Shard[]>(withNumberOfShards) }, numberOfShards{ withNumberOfShards }
+    {
+        NXA_ASSERT_TRUE((withNumberOfShards > 0) && ((withNumberOfShards & (withNumberOfShards - 1)) == 0));
+    }
+    ~ConcurrentLruCache() override = default;
+
+    // -- Instance Methods
+    count numberOfShardsUsed() const
+    {
+        return this->numberOfShards;
+    }
+
+    count size() const
+    {
+        count result = 0;
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            result += shard.cache.size();
+        }
+
+        return result;
+    }
+
+    boolean empty() const
+    {
+        return this->size() == 0;
+    }
+
+    count totalCost() const
+    {
+        count result = 0;
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            result += shard.cache.totalCost();
+        }
+
+        return result;
+    }
+
+    void resizeCache(count nth)
+    {
+        // -- Each shard gets an even share of the limit, rounded up so that small caches can still hold entries.
+        count limitPerShard = (nth / this->numberOfShards) + ((nth % this->numberOfShards) ? 1 : 0);
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.resizeCache(limitPerShard);
+        }
+    }
+
+    void setMaximumTotalCost(count maximum)
+    {
+        count maximumPerShard = (maximum / this->numberOfShards) + ((maximum % this->numberOfShards) ? 1 : 0);
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.setMaximumTotalCost(maximumPerShard);
+        }
+    }
+
+    // -- The function can be called concurrently from different shards so it must be thread-safe.
+    void setCostFunction(std::function<count(const K&, const V&)> function)
+    {
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.setCostFunction(function);
+        }
+    }
+
+    // -- The callback is called while its shard is locked and can be called concurrently from different shards.
+    void setEvictionCallback(std::function<void(const K&, const V&)> callback)
+    {
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.setEvictionCallback(callback);
+        }
+    }
+
+    void setStatisticsEnabled(boolean enabled)
+    {
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.setStatisticsEnabled(enabled);
+        }
+    }
+
+    // -- Statistics are summed over all the shards.
+    LruCacheStatistics statistics() const
+    {
+        LruCacheStatistics result;
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            result += shard.cache.statistics();
+        }
+
+        return result;
+    }
+
+    void resetStatistics()
+    {
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.resetStatistics();
+        }
+    }
+
+    // -- Returns a copy of the value since a reference would outlive the lock protecting it.
+    Optional<V> find(const K& k)
+    {
+        auto& shard = this->shardForKey(k);
+        std::lock_guard<std::mutex> guard(shard.lock);
+
+        auto found = shard.cache.find(k);
+        if (found == shard.cache.end()) {
+            return nothing;
+        }
+
+        return found->second;
+    }
+
+    void insert(const K& k, const V& v)
+    {
+        auto& shard = this->shardForKey(k);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.cache.insert(k, v);
+    }
+
+    void erase(const K& k)
+    {
+        auto& shard = this->shardForKey(k);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.cache.erase(k);
+    }
+
+    void clear()
+    {
+        for (count index = 0; index < this->numberOfShards; ++index) {
+            auto& shard = this->shards[index];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.cache.clear();
+        }
+    }
+};
+
+}
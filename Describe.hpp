@@ -23,6 +23,7 @@
 
 #include <Base/String.hpp>
 #include <Base/MutableString.hpp>
+#include <Base/StringBuilder.hpp>
 #include <Base/Array.hpp>
 
 namespace NxA {
@@ -43,7 +44,7 @@ public:
 
     String indentedLine(String line) const
     {
-        return String::stringWithFormat("%s%s\n", String::stringWithRepeatedCharacter(indent_ * 4, ' '), line);
+        return String::stringWithFormat("%*s%s\n", indent_ * 4, "", line);
     }
 };
 
@@ -142,7 +143,8 @@ struct Describer<Array<T, I, Rest...>>
             return indented.indentedLine(R"(<Array length="0" />)");
         }
 
-        auto result = MutableString::stringWithFormat(indented.indentedLine(R"(<Array length="%ld">)"), items.length());
+        StringBuilder result;
+        result.append(indented.indentedLine(String::stringWithFormat(R"(<Array length="%ld">)", items.length())));
 
         for (auto&& item : items) {
             result.append(Describer<T>::describeWithState(item, indented));
@@ -150,7 +152,7 @@ struct Describer<Array<T, I, Rest...>>
 
         result.append(indented.indentedLine("</Array>"));
 
-        return {std::move(result)};
+        return result.asString();
     }
 };
 
@@ -165,7 +167,8 @@ struct Describer<MutableArray<T, I, Rest...>>
             return indented.indentedLine(R"(<MutableArray length="0" />)");
         }
 
-        auto result = MutableString::stringWithFormat(indented.indentedLine(R"(<MutableArray length="%ld">)"), items.length());
+        StringBuilder result;
+        result.append(indented.indentedLine(String::stringWithFormat(R"(<MutableArray length="%ld">)", items.length())));
 
         for (auto&& item : items) {
             result.append(Describer<T>::describeWithState(item, indented));
@@ -173,7 +176,7 @@ struct Describer<MutableArray<T, I, Rest...>>
 
         result.append(indented.indentedLine("</MutableArray>"));
 
-        return {std::move(result)};
+        return result.asString();
     }
 };
 
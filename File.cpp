@@ -28,6 +28,7 @@
 #include "Base/Assert.hpp"
 #include "Base/File.hpp"
 #include "Base/Platform.hpp"
+#include "Base/Internal/Base64Codec.hpp"
 
 #if defined(_WIN32)
 #undef WINVER
@@ -39,6 +40,8 @@
 #include <initguid.h>
 #include <KnownFolders.h>
 #include <wchar.h>
+#include <codecvt>
+#include <locale>
 #elif defined(__APPLE__)
 #include <dirent.h>
 #include <pwd.h>
@@ -56,6 +59,11 @@
 
 using namespace NxA;
 
+// -- Constants
+
+// -- Parts are a whole number of lines so that most of them are encoded without carrying bytes over to the next one.
+static constexpr count sizeOfBase64Parts = Base64Codec::bytesPerLine * 16384;
+
 // -- mark Class Methods
 
 Blob File::readFileAt(const String& path)
@@ -105,6 +113,77 @@ void File::writeBlobToFileAt(const Blob& content, const String& path)
     }
 }
 
+void File::writeBase64EncodingOfFileAtToFileAt(const String& sourcePath, const String& destinationPath)
+{
+    NXA_ASSERT_TRUE(sourcePath.length() > 0);
+    NXA_ASSERT_TRUE(destinationPath.length() > 0);
+
+    std::fstream source(sourcePath.asUTF8(), std::ios::in | std::ios::binary);
+    if (!source.is_open()) {
+        throw FileError::exceptionWith("Error reading file at '%s'.", sourcePath.asUTF8());
+    }
+
+    std::fstream destination(destinationPath.asUTF8(), std::ios::out | std::ios::binary);
+    if (!destination.is_open()) {
+        throw FileError::exceptionWith("Error writing to file at '%s'.", destinationPath.asUTF8());
+    }
+
+    auto part = std::make_unique<byte[]>(sizeOfBase64Parts);
+    auto encodedPart = std::make_unique<character[]>(Base64Codec::maximumLengthOfEncodingForSize(sizeOfBase64Parts));
+    Base64Codec::EncodingState state;
+
+    do {
+        source.read(reinterpret_cast<character*>(part.get()), sizeOfBase64Parts);
+        if (source.bad()) {
+            throw FileError::exceptionWith("Error reading file at '%s'.", sourcePath.asUTF8());
+        }
+
+        auto length = Base64Codec::copyEncodingFromAndSizeTo(part.get(), source.gcount(), encodedPart.get(), state);
+        destination.write(encodedPart.get(), length);
+    } while (!source.eof());
+
+    auto length = Base64Codec::copyEndOfEncodingTo(encodedPart.get(), state);
+    destination.write(encodedPart.get(), length);
+
+    if (destination.rdstate() & std::ifstream::failbit) {
+        throw FileError::exceptionWith("Error writing to file at '%s'.", destinationPath.asUTF8());
+    }
+}
+
+void File::writeBase64DecodingOfFileAtToFileAt(const String& sourcePath, const String& destinationPath)
+{
+    NXA_ASSERT_TRUE(sourcePath.length() > 0);
+    NXA_ASSERT_TRUE(destinationPath.length() > 0);
+
+    std::fstream source(sourcePath.asUTF8(), std::ios::in | std::ios::binary);
+    if (!source.is_open()) {
+        throw FileError::exceptionWith("Error reading file at '%s'.", sourcePath.asUTF8());
+    }
+
+    std::fstream destination(destinationPath.asUTF8(), std::ios::out | std::ios::binary);
+    if (!destination.is_open()) {
+        throw FileError::exceptionWith("Error writing to file at '%s'.", destinationPath.asUTF8());
+    }
+
+    auto part = std::make_unique<character[]>(sizeOfBase64Parts);
+    auto decodedPart = std::make_unique<byte[]>(Base64Codec::sizeOfDecodingBufferForLength(sizeOfBase64Parts));
+    Base64Codec::DecodingState state;
+
+    do {
+        source.read(part.get(), sizeOfBase64Parts);
+        if (source.bad()) {
+            throw FileError::exceptionWith("Error reading file at '%s'.", sourcePath.asUTF8());
+        }
+
+        auto size = Base64Codec::copyDecodingFromAndLengthTo(part.get(), source.gcount(), decodedPart.get(), state);
+        destination.write(reinterpret_cast<const character*>(decodedPart.get()), size);
+    } while (!source.eof());
+
+    if (destination.rdstate() & std::ifstream::failbit) {
+        throw FileError::exceptionWith("Error writing to file at '%s'.", destinationPath.asUTF8());
+    }
+}
+
 void File::deleteFileAt(const String& path)
 {
     NXA_ASSERT_TRUE(path.length() > 0);
@@ -124,9 +203,7 @@ String File::pathSeparator()
 
 String File::removePrefixFromPath(const String& prefix, const String& path)
 {
-    MutableString fullPrefix(prefix);
-
-    const character* separator;
+    StringView separator;
     if (Platform::CurrentPlatform == Platform::Kind::Windows) {
         separator = R"(\)";
     }
@@ -134,16 +211,22 @@ String File::removePrefixFromPath(const String& prefix, const String& path)
         separator = "/";
     }
 
-    if (!fullPrefix.hasPostfix(separator)) {
-        fullPrefix.append(separator);
+    // -- Views let us check the prefix and the separator following it without building the full prefix first.
+    auto prefixView = prefix.asStringView();
+    auto pathView = path.asStringView();
+    auto pathHasPrefix = pathView.hasPrefix(prefixView);
+
+    count lengthToCrop = prefixView.length();
+    if (!prefixView.hasPostfix(separator)) {
+        pathHasPrefix = pathHasPrefix && pathView.subString(lengthToCrop).hasPrefix(separator);
+        lengthToCrop += separator.length();
     }
 
-    if (!path.hasPrefix(fullPrefix.asUTF8())) {
+    if (!pathHasPrefix) {
         NXA_ALOG("Path '%s' does not have prefix '%s'.", path.asUTF8(), prefix.asUTF8());
     }
 
-    count lengthToCrop = fullPrefix.length();
-    return path.subString(lengthToCrop);
+    return String{ pathView.subString(lengthToCrop) };
 }
 
 String File::extensionForFilePath(const String& path)
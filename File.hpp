@@ -28,6 +28,8 @@
 #include <Base/MutableString.hpp>
 #include <Base/String.hpp>
 
+#include <fstream>
+
 namespace NxA {
 
 class String;
@@ -44,6 +46,30 @@ public:
     // -- Class Methods
     static Blob readFileAt(const String&);
     static void writeBlobToFileAt(const Blob&, const String&);
+
+    // -- Encodes or decodes the base64 content of a file a part at a time, so that files which don't fit in memory can
+    // -- be converted. The encoding is the same as the one returned by Blob::base64String().
+    static void writeBase64EncodingOfFileAtToFileAt(const String&, const String&);
+    static void writeBase64DecodingOfFileAtToFileAt(const String&, const String&);
+
+    // -- Writes the strings in the array, separated by join, without creating the joined string in memory first.
+    template <typename ArrayType>
+    static void writeArrayJoinedWithStringToFileAt(const ArrayType& array, const String& join, const String& path)
+    {
+        std::fstream file(path.asUTF8(), std::ios::out | std::ios::binary);
+        if (!file.is_open()) {
+            throw FileError::exceptionWith("Error writing to file at '%s'.", path.asUTF8());
+        }
+
+        StringJoiner::forEachPieceOfArrayJoinedWith(array, join.asStringView(), [&file](const character* characters, count length) {
+            file.write(characters, length);
+        });
+
+        if (file.rdstate() & std::ifstream::failbit) {
+            throw FileError::exceptionWith("Error writing to file at '%s'.", path.asUTF8());
+        }
+    }
+
     static void deleteFileAt(const String&);
 
     static String pathSeparator();
@@ -0,0 +1,446 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+
+#include "Base/Internal/Base64Codec.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NXA_BASE64_CODEC_HAS_SSSE3
+#define NXA_BASE64_CODEC_HAS_AVX2
+#define NXA_BASE64_CODEC_SSSE3_FUNCTION __attribute__((target("ssse3")))
+#define NXA_BASE64_CODEC_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+
+using namespace NxA;
+
+// -- Constants
+
+constexpr count Base64Codec::groupsPerLine;
+constexpr count Base64Codec::bytesPerLine;
+
+static constexpr character encodingAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static constexpr byte characterNotInTheAlphabet = 0xff;
+
+struct DecodingTable
+{
+    byte values[256];
+
+    constexpr DecodingTable() : values{ }
+    {
+        for (count index = 0; index < 256; ++index) {
+            this->values[index] = characterNotInTheAlphabet;
+        }
+
+        for (count index = 0; index < 64; ++index) {
+            this->values[static_cast<byte>(encodingAlphabet[index])] = static_cast<byte>(index);
+        }
+    }
+};
+
+static constexpr DecodingTable decodingTable{ };
+
+// -- Portable Implementation
+
+static inline void copyEncodingOfGroupFromTo(const byte* source, character* destination)
+{
+    uinteger32 group = (static_cast<uinteger32>(source[0]) << 16) | (static_cast<uinteger32>(source[1]) << 8) | source[2];
+    destination[0] = encodingAlphabet[group >> 18];
+    destination[1] = encodingAlphabet[(group >> 12) & 0x3f];
+    destination[2] = encodingAlphabet[(group >> 6) & 0x3f];
+    destination[3] = encodingAlphabet[group & 0x3f];
+}
+
+static void copyEncodingOfGroupsPortable(const byte* source, count numberOfGroups, character* destination, count groupIndex)
+{
+    for (; groupIndex < numberOfGroups; ++groupIndex) {
+        copyEncodingOfGroupFromTo(source + (groupIndex * 3), destination + (groupIndex * 4));
+    }
+}
+
+// -- Decodes whole groups of four characters, up to the first one containing a character outside of the alphabet,
+// -- and returns the number of characters decoded.
+static count copyDecodingOfGroupsPortable(const byte* source, count length, byte* destination, count index)
+{
+    for (; (index + 4) <= length; index += 4) {
+        uinteger32 first = decodingTable.values[source[index]];
+        uinteger32 second = decodingTable.values[source[index + 1]];
+        uinteger32 third = decodingTable.values[source[index + 2]];
+        uinteger32 fourth = decodingTable.values[source[index + 3]];
+        if ((first | second | third | fourth) & 0xc0) {
+            break;
+        }
+
+        uinteger32 group = (first << 18) | (second << 12) | (third << 6) | fourth;
+        auto output = destination + ((index / 4) * 3);
+        output[0] = static_cast<byte>(group >> 16);
+        output[1] = static_cast<byte>(group >> 8);
+        output[2] = static_cast<byte>(group);
+    }
+
+    return index;
+}
+
+#if defined(NXA_BASE64_CODEC_HAS_SSSE3)
+
+// -- SSSE3 Implementation
+
+// -- Vectorized base64 from "Faster Base64 Encoding and Decoding Using AVX2 Instructions" by Wojciech Muła,
+// -- Nick Kopp and Daniel Lemire.
+NXA_BASE64_CODEC_SSSE3_FUNCTION static inline __m128i encodingOfGroupsSSSE3(__m128i bytes)
+{
+    // -- Each group of three bytes is spread over four, the multiplies then shift each sextet into its own byte.
+    auto input = _mm_shuffle_epi8(bytes, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    auto firstAndThirdSextets = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    auto secondAndFourthSextets = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    auto sextets = _mm_or_si128(firstAndThirdSextets, secondAndFourthSextets);
+
+    // -- Sextets are turned into characters by adding the offset of the range of the alphabet they fall in.
+    auto ranges = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+    ranges = _mm_or_si128(ranges, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+    auto offsets = _mm_shuffle_epi8(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                  '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), ranges);
+    return _mm_add_epi8(sextets, offsets);
+}
+
+NXA_BASE64_CODEC_SSSE3_FUNCTION static void copyEncodingOfGroupsSSSE3(const byte* source, count numberOfGroups, count readableSize,
+                                                                      character* destination, count groupIndex)
+{
+    // -- Four groups are encoded from each 16 byte load, the last four bytes loaded just need to be readable.
+    for (; ((groupIndex + 4) <= numberOfGroups) && (((groupIndex * 3) + 16) <= readableSize); groupIndex += 4) {
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + (groupIndex * 3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + (groupIndex * 4)), encodingOfGroupsSSSE3(bytes));
+    }
+
+    copyEncodingOfGroupsPortable(source, numberOfGroups, destination, groupIndex);
+}
+
+// -- Returns the sextets for the 16 characters, or nothing if one of them is outside of the alphabet.
+NXA_BASE64_CODEC_SSSE3_FUNCTION static inline boolean sextetsForCharactersSSSE3(__m128i characters, __m128i& sextets)
+{
+    // -- Each nibble maps to a set of bits, a character is in the alphabet only if the sets for its two nibbles don't overlap.
+    auto highNibbles = _mm_and_si128(_mm_srli_epi32(characters, 4), _mm_set1_epi8(0x0f));
+    auto lowNibbles = _mm_and_si128(characters, _mm_set1_epi8(0x0f));
+    auto lowBits = _mm_shuffle_epi8(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a), lowNibbles);
+    auto highBits = _mm_shuffle_epi8(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), highNibbles);
+    if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lowBits, highBits), _mm_setzero_si128()))) {
+        return false;
+    }
+
+    // -- The high nibble tells which range of the alphabet a character is in, except for '/' which shares it with '+'.
+    auto ranges = _mm_add_epi8(_mm_cmpeq_epi8(characters, _mm_set1_epi8('/')), highNibbles);
+    auto offsets = _mm_shuffle_epi8(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), ranges);
+    sextets = _mm_add_epi8(characters, offsets);
+
+    return true;
+}
+
+NXA_BASE64_CODEC_SSSE3_FUNCTION static count copyDecodingOfGroupsSSSE3(const byte* source, count length, byte* destination, count index)
+{
+    // -- Each 16 byte store only holds 12 decoded bytes, the remaining ones are overwritten by the next store.
+    for (; (index + 16) <= length; index += 16) {
+        __m128i sextets;
+        if (!sextetsForCharactersSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index)), sextets)) {
+            break;
+        }
+
+        auto pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+        auto groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        auto bytes = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + ((index / 4) * 3)), bytes);
+    }
+
+    return copyDecodingOfGroupsPortable(source, length, destination, index);
+}
+
+static boolean processorSupportsSSSE3()
+{
+    static const boolean supported = __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+#endif
+
+#if defined(NXA_BASE64_CODEC_HAS_AVX2)
+
+// -- AVX2 Implementation
+
+// -- Same as the SSSE3 version, with each 128 bit lane handling its own 16 characters.
+NXA_BASE64_CODEC_AVX2_FUNCTION static void copyEncodingOfGroupsAVX2(const byte* source, count numberOfGroups, count readableSize,
+                                                                    character* destination, count groupIndex)
+{
+    // -- Eight groups are encoded from two overlapping 16 byte loads, one for each lane.
+    for (; ((groupIndex + 8) <= numberOfGroups) && (((groupIndex * 3) + 28) <= readableSize); groupIndex += 8) {
+        auto groups = source + (groupIndex * 3);
+        auto bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(groups))),
+                                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(groups + 12)), 1);
+
+        auto input = _mm256_shuffle_epi8(bytes, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                                10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+        auto firstAndThirdSextets = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        auto secondAndFourthSextets = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        auto sextets = _mm256_or_si256(firstAndThirdSextets, secondAndFourthSextets);
+
+        auto ranges = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+        ranges = _mm256_or_si256(ranges, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets), _mm256_set1_epi8(13)));
+        auto offsets = _mm256_shuffle_epi8(_mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                                            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), ranges);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + (groupIndex * 4)), _mm256_add_epi8(sextets, offsets));
+    }
+
+    copyEncodingOfGroupsPortable(source, numberOfGroups, destination, groupIndex);
+}
+
+NXA_BASE64_CODEC_AVX2_FUNCTION static count copyDecodingOfGroupsAVX2(const byte* source, count length, byte* destination, count index)
+{
+    // -- Each 32 byte store only holds 24 decoded bytes, the remaining ones are overwritten by the next store.
+    for (; (index + 32) <= length; index += 32) {
+        auto characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+
+        auto highNibbles = _mm256_and_si256(_mm256_srli_epi32(characters, 4), _mm256_set1_epi8(0x0f));
+        auto lowNibbles = _mm256_and_si256(characters, _mm256_set1_epi8(0x0f));
+        auto lowBits = _mm256_shuffle_epi8(_mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+                                                            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a), lowNibbles);
+        auto highBits = _mm256_shuffle_epi8(_mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                             0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), highNibbles);
+        if (!_mm256_testz_si256(lowBits, highBits)) {
+            break;
+        }
+
+        auto ranges = _mm256_add_epi8(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8('/')), highNibbles);
+        auto offsets = _mm256_shuffle_epi8(_mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), ranges);
+        auto sextets = _mm256_add_epi8(characters, offsets);
+
+        auto pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        auto groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        auto bytes = _mm256_shuffle_epi8(groups, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                                  2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + ((index / 4) * 3)), bytes);
+    }
+
+    return copyDecodingOfGroupsPortable(source, length, destination, index);
+}
+
+static boolean processorSupportsAVX2()
+{
+    static const boolean supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif
+
+// -- Encodes the groups, starting new lines as needed, and returns the number of characters written.
+static count copyEncodingOfGroupsFromTo(const byte* source, count numberOfGroups, count readableSize, character* destination,
+                                        Base64Codec::EncodingState& state)
+{
+    auto start = destination;
+
+    while (numberOfGroups) {
+        auto numberOfGroupsOnThisLine = std::min(numberOfGroups, Base64Codec::groupsPerLine - state.numberOfGroupsOnTheLine);
+
+#if defined(NXA_BASE64_CODEC_HAS_AVX2)
+        if (processorSupportsAVX2()) {
+            copyEncodingOfGroupsAVX2(source, numberOfGroupsOnThisLine, readableSize, destination, 0);
+        }
+        else
+#endif
+#if defined(NXA_BASE64_CODEC_HAS_SSSE3)
+        if (processorSupportsSSSE3()) {
+            copyEncodingOfGroupsSSSE3(source, numberOfGroupsOnThisLine, readableSize, destination, 0);
+        }
+        else
+#endif
+        {
+            copyEncodingOfGroupsPortable(source, numberOfGroupsOnThisLine, destination, 0);
+        }
+
+        source += numberOfGroupsOnThisLine * 3;
+        readableSize -= numberOfGroupsOnThisLine * 3;
+        destination += numberOfGroupsOnThisLine * 4;
+        numberOfGroups -= numberOfGroupsOnThisLine;
+
+        state.numberOfGroupsOnTheLine += numberOfGroupsOnThisLine;
+        if (state.numberOfGroupsOnTheLine == Base64Codec::groupsPerLine) {
+            *destination++ = '\n';
+            state.numberOfGroupsOnTheLine = 0;
+        }
+    }
+
+    return destination - start;
+}
+
+static count copyDecodingOfGroupsFromTo(const byte* source, count length, byte* destination)
+{
+#if defined(NXA_BASE64_CODEC_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        return copyDecodingOfGroupsAVX2(source, length, destination, 0);
+    }
+#endif
+#if defined(NXA_BASE64_CODEC_HAS_SSSE3)
+    if (processorSupportsSSSE3()) {
+        return copyDecodingOfGroupsSSSE3(source, length, destination, 0);
+    }
+#endif
+    return copyDecodingOfGroupsPortable(source, length, destination, 0);
+}
+
+// -- Class Methods
+
+count Base64Codec::lengthOfEncodingForSize(count size)
+{
+    return (((size + 2) / 3) * 4) + ((size / 3) / Base64Codec::groupsPerLine) + 1;
+}
+
+void Base64Codec::copyEncodingFromAndSizeTo(const byte* source, count size, character* destination)
+{
+    EncodingState state;
+    auto length = Base64Codec::copyEncodingFromAndSizeTo(source, size, destination, state);
+    Base64Codec::copyEndOfEncodingTo(destination + length, state);
+}
+
+count Base64Codec::maximumLengthOfEncodingForSize(count size)
+{
+    // -- Leaves room for the bytes left over from a previous part and for the end of the encoding.
+    return (((size / 3) + 2) * 4) + (size / Base64Codec::bytesPerLine) + 2;
+}
+
+count Base64Codec::copyEncodingFromAndSizeTo(const byte* source, count size, character* destination, EncodingState& state)
+{
+    auto start = destination;
+
+    if (state.numberOfPendingBytes) {
+        auto numberOfMissingBytes = 3 - state.numberOfPendingBytes;
+        if (size < numberOfMissingBytes) {
+            ::memcpy(state.pendingBytes + state.numberOfPendingBytes, source, size);
+            state.numberOfPendingBytes += size;
+            return 0;
+        }
+
+        byte group[3];
+        ::memcpy(group, state.pendingBytes, state.numberOfPendingBytes);
+        ::memcpy(group + state.numberOfPendingBytes, source, numberOfMissingBytes);
+        destination += copyEncodingOfGroupsFromTo(group, 1, sizeof(group), destination, state);
+
+        source += numberOfMissingBytes;
+        size -= numberOfMissingBytes;
+    }
+
+    auto numberOfGroups = size / 3;
+    destination += copyEncodingOfGroupsFromTo(source, numberOfGroups, size, destination, state);
+
+    state.numberOfPendingBytes = size - (numberOfGroups * 3);
+    ::memcpy(state.pendingBytes, source + (numberOfGroups * 3), state.numberOfPendingBytes);
+
+    return destination - start;
+}
+
+count Base64Codec::copyEndOfEncodingTo(character* destination, EncodingState& state)
+{
+    auto start = destination;
+
+    if (state.numberOfPendingBytes) {
+        byte group[3] = { state.pendingBytes[0], 0, 0 };
+        if (state.numberOfPendingBytes == 2) {
+            group[1] = state.pendingBytes[1];
+        }
+
+        copyEncodingOfGroupFromTo(group, destination);
+        destination[3] = '=';
+        if (state.numberOfPendingBytes == 1) {
+            destination[2] = '=';
+        }
+
+        destination += 4;
+    }
+
+    *destination++ = '\n';
+
+    state = EncodingState{ };
+
+    return destination - start;
+}
+
+count Base64Codec::sizeOfDecodingBufferForLength(count length)
+{
+    // -- Leaves room for a byte completing a group from a previous part and for the end of the last vector store.
+    return (((length / 4) + 1) * 3) + 8;
+}
+
+count Base64Codec::copyDecodingFromAndLengthTo(const character* text, count length, byte* destination, DecodingState& state)
+{
+    auto start = destination;
+    auto source = reinterpret_cast<const byte*>(text);
+
+    count index = 0;
+    while (index < length) {
+        // -- Whole groups are decoded in bulk until one contains a character outside of the alphabet, which is then
+        // -- skipped by decoding one character at a time until the next group starts.
+        if (!state.numberOfPendingCharacters) {
+            auto numberOfCharactersDecoded = copyDecodingOfGroupsFromTo(source + index, length - index, destination);
+            index += numberOfCharactersDecoded;
+            destination += (numberOfCharactersDecoded / 4) * 3;
+            if (index == length) {
+                break;
+            }
+        }
+
+        uinteger32 sextet = decodingTable.values[source[index++]];
+        if (sextet == characterNotInTheAlphabet) {
+            continue;
+        }
+
+        // -- Bytes are written as soon as they are complete so that nothing needs to be flushed at the end.
+        switch (state.numberOfPendingCharacters) {
+            case 0: {
+                state.pendingBits = sextet;
+                state.numberOfPendingCharacters = 1;
+                break;
+            }
+            case 1: {
+                *destination++ = static_cast<byte>((state.pendingBits << 2) | (sextet >> 4));
+                state.pendingBits = sextet & 0x0f;
+                state.numberOfPendingCharacters = 2;
+                break;
+            }
+            case 2: {
+                *destination++ = static_cast<byte>((state.pendingBits << 4) | (sextet >> 2));
+                state.pendingBits = sextet & 0x03;
+                state.numberOfPendingCharacters = 3;
+                break;
+            }
+            default: {
+                *destination++ = static_cast<byte>((state.pendingBits << 6) | sextet);
+                state.pendingBits = 0;
+                state.numberOfPendingCharacters = 0;
+                break;
+            }
+        }
+    }
+
+    return destination - start;
+}
@@ -0,0 +1,73 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Uncopyable.hpp>
+
+namespace NxA {
+
+// -- Encodes and decodes base64 in the format libb64 produced, which existing data was saved with: lines of 72
+// -- characters, each followed by a line ending, and a line ending at the very end. Characters outside of the base64
+// -- alphabet, like line endings and padding, are skipped when decoding. Data can be given in several parts, with
+// -- the state carried over from one part to the next, so that it doesn't have to be held in memory all at once.
+class Base64Codec : private Uncopyable
+{
+public:
+    // -- Constants
+    static constexpr count groupsPerLine = 18;
+    static constexpr count bytesPerLine = groupsPerLine * 3;
+
+    // -- Types
+    struct EncodingState
+    {
+        count numberOfGroupsOnTheLine = 0;
+        byte pendingBytes[2];
+        count numberOfPendingBytes = 0;
+    };
+
+    struct DecodingState
+    {
+        uinteger32 pendingBits = 0;
+        count numberOfPendingCharacters = 0;
+    };
+
+    // -- Constructors & Destructors
+    Base64Codec() = delete;
+
+    // -- Class Methods
+    static count lengthOfEncodingForSize(count);
+    static void copyEncodingFromAndSizeTo(const byte*, count, character*);
+
+    // -- Encodes the next part of the data and returns the number of characters written. The destination must have
+    // -- room for maximumLengthOfEncodingForSize() characters.
+    static count maximumLengthOfEncodingForSize(count);
+    static count copyEncodingFromAndSizeTo(const byte*, count, character*, EncodingState&);
+    static count copyEndOfEncodingTo(character*, EncodingState&);
+
+    // -- Decodes the next part of the text and returns the number of bytes written. The destination must have room
+    // -- for sizeOfDecodingBufferForLength() bytes, which is slightly more than what can be written.
+    static count sizeOfDecodingBufferForLength(count);
+    static count copyDecodingFromAndLengthTo(const character*, count, byte*, DecodingState&);
+};
+
+}
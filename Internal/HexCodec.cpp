@@ -0,0 +1,202 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+
+#include "Base/Internal/HexCodec.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define NXA_HEX_CODEC_HAS_SSE2
+#endif
+
+using namespace NxA;
+
+// -- Constants
+
+static constexpr character hexadecimalDigits[] = "0123456789abcdef";
+static constexpr byte characterNotAHexadecimalDigit = 0xff;
+
+struct EncodingTable
+{
+    character pairs[512];
+
+    constexpr EncodingTable() : pairs{ }
+    {
+        for (count index = 0; index < 256; ++index) {
+            this->pairs[index * 2] = hexadecimalDigits[index >> 4];
+            this->pairs[(index * 2) + 1] = hexadecimalDigits[index & 0x0f];
+        }
+    }
+};
+
+struct DecodingTable
+{
+    byte values[256];
+
+    constexpr DecodingTable() : values{ }
+    {
+        for (count index = 0; index < 256; ++index) {
+            this->values[index] = characterNotAHexadecimalDigit;
+        }
+
+        for (count index = 0; index < 16; ++index) {
+            this->values[static_cast<byte>(hexadecimalDigits[index])] = static_cast<byte>(index);
+        }
+
+        for (count index = 10; index < 16; ++index) {
+            this->values['A' + index - 10] = static_cast<byte>(index);
+        }
+    }
+};
+
+static constexpr EncodingTable encodingTable{ };
+static constexpr DecodingTable decodingTable{ };
+
+// -- Portable Implementation
+
+static void copyEncodingPortable(const byte* source, count size, character* destination, count index)
+{
+    for (; index < size; ++index) {
+        auto pair = encodingTable.pairs + (source[index] * 2);
+        destination[index * 2] = pair[0];
+        destination[(index * 2) + 1] = pair[1];
+    }
+}
+
+// -- Decodes the characters one at a time, skipping the ones that are not digits, and returns the number of bytes written.
+static count copyDecodingPortable(const byte* source, count length, byte* destination, count index)
+{
+    auto start = destination;
+
+    byte highDigit = 0;
+    boolean hasHighDigit = false;
+
+    for (; index < length; ++index) {
+        auto digit = decodingTable.values[source[index]];
+        if (digit == characterNotAHexadecimalDigit) {
+            continue;
+        }
+
+        if (hasHighDigit) {
+            *destination++ = static_cast<byte>((highDigit << 4) | digit);
+        }
+        else {
+            highDigit = digit;
+        }
+
+        hasHighDigit = !hasHighDigit;
+    }
+
+    return destination - start;
+}
+
+#if defined(NXA_HEX_CODEC_HAS_SSE2)
+
+// -- SSE2 Implementation
+
+static inline __m128i digitsForNibblesSSE2(__m128i nibbles)
+{
+    // -- Nibbles above 9 need to skip the characters between '9' and 'a'.
+    auto isLetter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(isLetter, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+static void copyEncodingSSE2(const byte* source, count size, character* destination)
+{
+    count index = 0;
+    for (; (index + 16) <= size; index += 16) {
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        auto highDigits = digitsForNibblesSSE2(_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0f)));
+        auto lowDigits = digitsForNibblesSSE2(_mm_and_si128(bytes, _mm_set1_epi8(0x0f)));
+
+        auto output = reinterpret_cast<__m128i*>(destination + (index * 2));
+        _mm_storeu_si128(output, _mm_unpacklo_epi8(highDigits, lowDigits));
+        _mm_storeu_si128(output + 1, _mm_unpackhi_epi8(highDigits, lowDigits));
+    }
+
+    copyEncodingPortable(source, size, destination, index);
+}
+
+// -- Returns the values of the 16 digits, or nothing if one of the characters is not a digit.
+static inline boolean valuesForDigitsSSE2(__m128i characters, __m128i& values)
+{
+    // -- Characters above 0x7f are negative when compared as signed values so they are never in the ranges.
+    auto lowerCaseCharacters = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+    auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)));
+    auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(lowerCaseCharacters, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmplt_epi8(lowerCaseCharacters, _mm_set1_epi8('f' + 1)));
+    if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff) {
+        return false;
+    }
+
+    values = _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(characters, _mm_set1_epi8('0'))),
+                          _mm_and_si128(isLetter, _mm_sub_epi8(lowerCaseCharacters, _mm_set1_epi8('a' - 10))));
+    return true;
+}
+
+// -- Combines each pair of digit values into a byte held in the low half of its 16 bit lane.
+static inline __m128i bytesForValuesSSE2(__m128i values)
+{
+    auto highDigits = _mm_and_si128(values, _mm_set1_epi16(0x00ff));
+    auto lowDigits = _mm_srli_epi16(values, 8);
+    return _mm_or_si128(_mm_slli_epi16(highDigits, 4), lowDigits);
+}
+
+static count copyDecodingSSE2(const byte* source, count length, byte* destination)
+{
+    count index = 0;
+    for (; (index + 32) <= length; index += 32) {
+        __m128i firstValues, secondValues;
+        if (!valuesForDigitsSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index)), firstValues) ||
+            !valuesForDigitsSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index + 16)), secondValues)) {
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + (index / 2)),
+                         _mm_packus_epi16(bytesForValuesSSE2(firstValues), bytesForValuesSSE2(secondValues)));
+    }
+
+    return (index / 2) + copyDecodingPortable(source, length, destination + (index / 2), index);
+}
+
+#endif
+
+// -- Class Methods
+
+void HexCodec::copyEncodingFromAndSizeTo(const byte* source, count size, character* destination)
+{
+#if defined(NXA_HEX_CODEC_HAS_SSE2)
+    copyEncodingSSE2(source, size, destination);
+#else
+    copyEncodingPortable(source, size, destination, 0);
+#endif
+}
+
+count HexCodec::copyDecodingFromAndLengthTo(const character* text, count length, byte* destination)
+{
+    auto source = reinterpret_cast<const byte*>(text);
+
+#if defined(NXA_HEX_CODEC_HAS_SSE2)
+    return copyDecodingSSE2(source, length, destination);
+#else
+    return copyDecodingPortable(source, length, destination, 0);
+#endif
+}
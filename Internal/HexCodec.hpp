@@ -0,0 +1,52 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Uncopyable.hpp>
+
+namespace NxA {
+
+// -- Encodes bytes as pairs of lower case hexadecimal digits. Upper and lower case digits are decoded, any other
+// -- character is skipped, as is a digit left without a pair at the end.
+class HexCodec : private Uncopyable
+{
+public:
+    // -- Constructors & Destructors
+    HexCodec() = delete;
+
+    // -- Class Methods
+    static count lengthOfEncodingForSize(count size)
+    {
+        return size * 2;
+    }
+    static void copyEncodingFromAndSizeTo(const byte*, count, character*);
+
+    static count maximumSizeOfDecodingForLength(count length)
+    {
+        return length / 2;
+    }
+    static count copyDecodingFromAndLengthTo(const character*, count, byte*);
+};
+
+}
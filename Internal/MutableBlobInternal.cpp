@@ -19,195 +19,6 @@
 //  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //
 
-// -- Base64 encoder/decoder
-
-#include <typeinfo>
-#include <Base/Types.hpp>
-
-namespace NxA {
-
-//-----------------------------------------------------------------------------
-/*
- This is part of the libb64 project, and has been placed in the public domain.
- For details, see http://sourceforge.net/projects/libb64
- */
-
-enum class base64_encodestep { step_A, step_B, step_C };
-
-struct base64_encodestate
-{
-    base64_encodestep step{base64_encodestep::step_A};
-    char result{0};
-    int stepcount{0};
-};
-
-enum class base64_decodestep { step_a, step_b, step_c, step_d };
-
-struct base64_decodestate
-{
-    base64_decodestep step{base64_decodestep::step_a};
-    char plainchar{0};
-};
-
-const int CHARS_PER_LINE = 72;
-
-char base64_encode_value(char value_in)
-{
-    static const char* encoding = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    if (value_in > 63)
-        return '=';
-    return encoding[(int)value_in];
-}
-
-int base64_encode_block(const char* plaintext_in, count length_in, char* code_out, base64_encodestate* state_in)
-{
-    const char* plainchar = plaintext_in;
-    const char* const plaintextend = plaintext_in + length_in;
-    char* codechar = code_out;
-    char result;
-    char fragment;
-
-    result = state_in->result;
-
-    switch (state_in->step) {
-        while (true) {
-            case base64_encodestep::step_A:
-                if (plainchar == plaintextend) {
-                    state_in->result = result;
-                    state_in->step = base64_encodestep::step_A;
-                    return static_cast<int>(codechar - code_out);
-                }
-                fragment = *plainchar++;
-                result = (fragment & 0x0fc) >> 2;
-                *codechar++ = base64_encode_value(result);
-                result = (fragment & 0x003) << 4;
-            case base64_encodestep::step_B:
-                if (plainchar == plaintextend) {
-                    state_in->result = result;
-                    state_in->step = base64_encodestep::step_B;
-                    return static_cast<int>(codechar - code_out);
-                }
-                fragment = *plainchar++;
-                result |= (fragment & 0x0f0) >> 4;
-                *codechar++ = base64_encode_value(result);
-                result = (fragment & 0x00f) << 2;
-            case base64_encodestep::step_C:
-                if (plainchar == plaintextend) {
-                    state_in->result = result;
-                    state_in->step = base64_encodestep::step_C;
-                    return static_cast<int>(codechar - code_out);
-                }
-                fragment = *plainchar++;
-                result |= (fragment & 0x0c0) >> 6;
-                *codechar++ = base64_encode_value(result);
-                result = (fragment & 0x03f) >> 0;
-                *codechar++ = base64_encode_value(result);
-
-                ++(state_in->stepcount);
-                if (state_in->stepcount == CHARS_PER_LINE / 4) {
-                    *codechar++ = '\n';
-                    state_in->stepcount = 0;
-                }
-        }
-    }
-    /* control should not reach here */
-    return static_cast<int>(codechar - code_out);
-}
-
-int base64_encode_blockend(char* code_out, base64_encodestate* state_in)
-{
-    char* codechar = code_out;
-
-    switch (state_in->step) {
-        case base64_encodestep::step_B:
-            *codechar++ = base64_encode_value(state_in->result);
-            *codechar++ = '=';
-            *codechar++ = '=';
-            break;
-        case base64_encodestep::step_C:
-            *codechar++ = base64_encode_value(state_in->result);
-            *codechar++ = '=';
-            break;
-        case base64_encodestep::step_A:
-            break;
-    }
-    *codechar++ = '\n';
-
-    return static_cast<int>(codechar - code_out);
-}
-
-int base64_decode_value(char value_in)
-{
-    static const char decoding[] = {62, -1, -1, -1, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -2, -1, -1, -1, 0,  1,  2,  3,  4,
-                                    5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1, -1,
-                                    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51};
-    static const char decoding_size = sizeof(decoding);
-    value_in -= 43;
-    if (value_in < 0 || value_in > decoding_size)
-        return -1;
-    return decoding[(int)value_in];
-}
-
-int base64_decode_block(const char* code_in, const count length_in, char* plaintext_out, base64_decodestate* state_in)
-{
-    const char* codechar = code_in;
-    char* plainchar = plaintext_out;
-    char fragment;
-
-    *plainchar = state_in->plainchar;
-
-    switch (state_in->step) {
-        while (true) {
-            case base64_decodestep::step_a:
-                do {
-                    if (codechar == code_in + length_in) {
-                        state_in->step = base64_decodestep::step_a;
-                        state_in->plainchar = *plainchar;
-                        return static_cast<int>(plainchar - plaintext_out);
-                    }
-                    fragment = (char)base64_decode_value(*codechar++);
-                } while (fragment < 0);
-                *plainchar = (fragment & 0x03f) << 2;
-            case base64_decodestep::step_b:
-                do {
-                    if (codechar == code_in + length_in) {
-                        state_in->step = base64_decodestep::step_b;
-                        state_in->plainchar = *plainchar;
-                        return static_cast<int>(plainchar - plaintext_out);
-                    }
-                    fragment = (char)base64_decode_value(*codechar++);
-                } while (fragment < 0);
-                *plainchar++ |= (fragment & 0x030) >> 4;
-                *plainchar = (fragment & 0x00f) << 4;
-            case base64_decodestep::step_c:
-                do {
-                    if (codechar == code_in + length_in) {
-                        state_in->step = base64_decodestep::step_c;
-                        state_in->plainchar = *plainchar;
-                        return static_cast<int>(plainchar - plaintext_out);
-                    }
-                    fragment = (char)base64_decode_value(*codechar++);
-                } while (fragment < 0);
-                *plainchar++ |= (fragment & 0x03c) >> 2;
-                *plainchar = (fragment & 0x003) << 6;
-            case base64_decodestep::step_d:
-                do {
-                    if (codechar == code_in + length_in) {
-                        state_in->step = base64_decodestep::step_d;
-                        state_in->plainchar = *plainchar;
-                        return static_cast<int>(plainchar - plaintext_out);
-                    }
-                    fragment = (char)base64_decode_value(*codechar++);
-                } while (fragment < 0);
-                *plainchar++ |= (fragment & 0x03f);
-        }
-    }
-
-    /* control should not reach here */
-    return static_cast<int>(plainchar - plaintext_out);
-}
-}
-
 #include "Base/Types.hpp"
 #include "Base/MutableString.hpp"
 
@@ -373,6 +184,8 @@ void MurmurHash3_x64_128(const void* key, const int len, const uint32_t seed, vo
 // -- MutableBlobInternal Class
 
 #include "Base/Internal/MutableBlobInternal.hpp"
+#include "Base/Internal/Base64Codec.hpp"
+#include "Base/Internal/HexCodec.hpp"
 #include "Base/String.hpp"
 
 using namespace NxA;
@@ -381,16 +194,20 @@ using namespace NxA;
 
 String MutableBlobInternal::base64StringFor(const byte* memory, count size)
 {
-    base64_encodestate encodeState;
+    std::string result;
+    result.resize(Base64Codec::lengthOfEncodingForSize(size));
+    Base64Codec::copyEncodingFromAndSizeTo(memory, size, &result[0]);
 
-    auto result = MutableBlobInternal::blobWithCapacity(size * 2);
-    auto* codeOut = reinterpret_cast<char*>(result->data());
-    int codeLength = base64_encode_block(reinterpret_cast<const char*>(memory), size, codeOut, &encodeState);
-    codeLength += base64_encode_blockend(codeOut + codeLength, &encodeState);
-    NXA_ASSERT_TRUE(codeLength <= size * 2);
+    return String{ std::move(result) };
+}
 
-    auto resultString = String::stringWithMemoryAndLength(codeOut, codeLength);
-    return resultString;
+String MutableBlobInternal::hexStringFor(const byte* memory, count size)
+{
+    std::string result;
+    result.resize(HexCodec::lengthOfEncodingForSize(size));
+    HexCodec::copyEncodingFromAndSizeTo(memory, size, &result[0]);
+
+    return String{ std::move(result) };
 }
 
 // -- Factory Methods
@@ -401,13 +218,19 @@ std::shared_ptr<MutableBlobInternal> MutableBlobInternal::blobWithBase64String(c
         return std::make_shared<MutableBlobInternal>();
     }
 
-    base64_decodestate decodeState;
+    Base64Codec::DecodingState state;
+
+    count length = string.length();
+    auto result = MutableBlobInternal::blobWithCapacity(Base64Codec::sizeOfDecodingBufferForLength(length));
+    result->resize(Base64Codec::copyDecodingFromAndLengthTo(string.asUTF8(), length, result->data(), state));
+    return result;
+}
 
-    count lengthIn = string.length();
-    auto result = MutableBlobInternal::blobWithCapacity(lengthIn);
-    count codeLength = base64_decode_block(string.asUTF8(), lengthIn, reinterpret_cast<char*>(result->data()), &decodeState);
-    NXA_ASSERT_TRUE(codeLength <= lengthIn);
-    result->resize(codeLength);
+std::shared_ptr<MutableBlobInternal> MutableBlobInternal::blobWithHexString(const String& string)
+{
+    count length = string.length();
+    auto result = MutableBlobInternal::blobWithCapacity(HexCodec::maximumSizeOfDecodingForLength(length));
+    result->resize(HexCodec::copyDecodingFromAndLengthTo(string.asUTF8(), length, result->data()));
     return result;
 }
 
@@ -439,13 +262,12 @@ String MutableBlobInternal::base64String() const
     }
 }
 
-String MutableBlobInternal::description() const
+String MutableBlobInternal::hexString() const
 {
-    MutableString result;
-
-    for (count index = 0; index < this->size(); ++index) {
-        result.append(String::stringWithFormat("%02x", (*this)[index]));
-    }
+    return MutableBlobInternal::hexStringFor(this->data(), this->size());
+}
 
-    return std::move(result);
+String MutableBlobInternal::description() const
+{
+    return this->hexString();
 }
@@ -57,6 +57,7 @@ struct MutableBlobInternal : public std::vector<byte>
     }
 
     static std::shared_ptr<MutableBlobInternal> blobWithBase64String(const String&);
+    static std::shared_ptr<MutableBlobInternal> blobWithHexString(const String&);
     static std::shared_ptr<MutableBlobInternal> blobWithStringWithTerminator(const String&);
     static std::shared_ptr<MutableBlobInternal> blobWithStringWithoutTerminator(const String&);
 
@@ -71,6 +72,7 @@ struct MutableBlobInternal : public std::vector<byte>
     }
 
     static String base64StringFor(const byte* memory, count size);
+    static String hexStringFor(const byte* memory, count size);
 
     // -- Operators
     bool operator==(const MutableBlobInternal& other) const
@@ -129,12 +131,16 @@ struct MutableBlobInternal : public std::vector<byte>
     }
 
     String base64String() const;
+    String hexString() const;
 
     void appendMemoryWithSize(const byte* data, count size)
     {
-        for (count index = 0; index < size; ++index) {
-            this->insert(this->end(), 1, data[index]);
-        }
+        this->insert(this->end(), data, data + size);
+    }
+
+    void appendZerosWithSize(count size)
+    {
+        this->resize(this->size() + size);
     }
 
     void append(MutableBlobInternal& other)
@@ -166,8 +172,7 @@ struct MutableBlobInternal : public std::vector<byte>
     {
         count paddingSize = (((this->size() + alignment - 1) / alignment) * alignment) - this->size();
         if (paddingSize > 0) {
-            auto padding = std::vector<byte>(paddingSize);
-            this->std::vector<byte>::insert(this->end(), padding.begin(), padding.end());
+            this->appendZerosWithSize(paddingSize);
         }
     }
 
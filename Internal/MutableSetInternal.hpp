@@ -25,6 +25,7 @@
 #include "Base/Assert.hpp"
 #include "Base/Types.hpp"
 #include "Base/MutableString.hpp"
+#include "Base/StringBuilder.hpp"
 
 #include <set>
 
@@ -163,7 +164,8 @@ struct MutableSetInternal : public std::set<T>
     String description(const DescriberState& state) const
     {
         auto indented = state.increaseIndent();
-        auto result = MutableString::stringWithFormat(indented.indentedLine(R"(<Set length="%ld">)"), this->length());
+        StringBuilder result;
+        result.append(indented.indentedLine(String::stringWithFormat(R"(<Set length="%ld">)", this->length())));
 
         for (auto&& item : *this) {
             result.append(NxA::describe(item, indented));
@@ -171,7 +173,7 @@ struct MutableSetInternal : public std::set<T>
 
         result.append(indented.indentedLine("</Set>"));
 
-        return {std::move(result)};
+        return result.asString();
     }
 
     virtual const character* className() const final
@@ -20,87 +20,46 @@
 //
 
 #include "Base/Blob.hpp"
+#include "Base/MutableBlob.hpp"
 #include "Base/MutableString.hpp"
 #include "Base/Internal/MutableStringInternal.hpp"
+#include "Base/Internal/UTF16Transcoder.hpp"
+#include "Base/Internal/UTF8Scanner.hpp"
+#include "Base/StringSearcher.hpp"
 #include "Base/String.hpp"
 #include "Base/Array.hpp"
 #include "Base/Assert.hpp"
 
 using namespace NxA;
 
-uinteger32 MutableStringInternal::hash() const
-{
-    return String::hashFor(this->asUTF8());
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(std::string& cppstring)
-{
-    return cppstring.c_str();
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(String& nxastring)
-{
-    return nxastring.asUTF8();
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(MutableString& nxastring)
-{
-    return nxastring.asUTF8();
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(MutableStringInternal& nxastring)
-{
-    return nxastring.asUTF8();
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(const std::string& cppstring)
-{
-    return cppstring.c_str();
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(const String& nxastring)
-{
-    return nxastring.asUTF8();
-}
-
-const character* MutableStringInternal::stringArgumentAsCharacter(const MutableString& nxastring)
-{
-    return nxastring.asUTF8();
-}
+// -- Constants
 
-const character* MutableStringInternal::stringArgumentAsCharacter(const MutableStringInternal& nxastring)
-{
-    return nxastring.asUTF8();
-}
+constexpr uinteger64 MutableStringInternal::cachedHashIsValid;
 
-NxA::boolean MutableStringInternal::hasNonPrintableCharacters() const
+uinteger32 MutableStringInternal::hash() const
 {
-    const character* input = this->asUTF8();
-    for (count index = 0; index < this->length(); ++index) {
-        byte value = input[index];
-        if (((value <= 0x1f) && (value != 0x09) && (value != 0x0a) && (value != 0x0d)) || (value == 0x7f)) {
-            return true;
-        }
+    auto cached = this->cachedHash.load(std::memory_order_relaxed);
+    if (cached & MutableStringInternal::cachedHashIsValid) {
+        return static_cast<uinteger32>(cached);
     }
 
-    return false;
+    // -- Two threads can end up computing the hash at the same time but they will both store the same value.
+    auto result = String::hashFor(this->data(), this->length());
+    this->cachedHash.store(MutableStringInternal::cachedHashIsValid | result, std::memory_order_relaxed);
+
+    return result;
 }
 
 count MutableStringInternal::indexOfFirstOccurenceOf(const String& other) const
 {
-    return this->indexOfFirstOccurenceOf(other.asUTF8());
+    return StringSearcher::indexOfFirstOccurenceOfIn(other.asStringView(), StringView{ *this });
 }
 
 count MutableStringInternal::indexOfFirstOccurenceOf(const character* other) const
 {
     NXA_ASSERT_NOT_NULL(other);
 
-    size_t pos = this->find(other);
-    if (pos == std::string::npos) {
-        return this->length();
-    }
-
-    return pos;
+    return StringSearcher::indexOfFirstOccurenceOfIn(StringView::viewWithUTF8(other), StringView{ *this });
 }
 
 count MutableStringInternal::indexOfLastOccurenceOf(const String& other) const
@@ -125,44 +84,35 @@ void MutableStringInternal::replaceOccurenceOfStringWith(const character* occure
     NXA_ASSERT_NOT_NULL(occurence);
     NXA_ASSERT_NOT_NULL(replacement);
 
+    this->invalidateCachedHash();
     boost::replace_all(*static_cast<std::string*>(this), occurence, replacement);
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::stringWithRepeatedCharacter(count number, character specificCharacter)
+std::string MutableStringInternal::stringWithRepeatedCharacter(count number, character specificCharacter)
 {
-    std::string asCStr(number, specificCharacter);
-    return std::make_shared<MutableStringInternal>(std::move(asCStr));
+    return std::string(number, specificCharacter);
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::stringWithUTF16AtAndSize(const byte* data, count size)
+std::string MutableStringInternal::stringWithUTF16AtAndSize(const byte* data, count size)
 {
-    if (size < 2) {
-        return std::make_shared<MutableStringInternal>();
+    // -- The big-endian characters are decoded in place, without swapping them into a copy first.
+    std::string result;
+    result.resize(UTF16Transcoder::lengthOfUTF8ForUTF16(data, size));
+    if (result.length()) {
+        UTF16Transcoder::copyUTF8FromUTF16AndSizeTo(data, size, reinterpret_cast<byte*>(&result[0]));
     }
 
-    Blob local;
-
-    if (Platform::endianOrder == Platform::LitleEndian) {
-        local = Platform::convertEndiannessOfUInteger16From(Blob::blobWithMemoryAndSize(data, size));
-        data = local.data();
-    }
-
-    count length = size / 2;
-    auto characters = reinterpret_cast<const integer16*>(data);
-
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return std::make_shared<MutableStringInternal>(
-        convert.to_bytes(reinterpret_cast<const char16_t*>(characters), reinterpret_cast<const char16_t*>(characters + length)));
+    return result;
 }
 
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::stringWithUTF16(const wchar_t* other, count num)
+std::string MutableStringInternal::stringWithUTF16(const wchar_t* other, count num)
 {
 	// TODO: Ideally not byte, but wchar_t
 	return MutableStringInternal::stringWithUTF16AtAndSize(reinterpret_cast<const byte*>(other), num);
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::stringWithUTF16(const Blob& other)
+std::string MutableStringInternal::stringWithUTF16(const Blob& other)
 {
     return MutableStringInternal::stringWithUTF16AtAndSize(other.data(), other.size());
 }
@@ -173,9 +123,9 @@ bool MutableStringInternal::operator==(const character* other) const
 {
     return this->std::string::compare(other) == 0;
 }
-bool MutableStringInternal::operator==(const MutableStringInternal& other) const
+bool MutableStringInternal::operator==(const StringView& other) const
 {
-    return this->std::string::compare(other) == 0;
+    return StringView{ *this } == other;
 }
 
 // -- Instance Methods
@@ -189,9 +139,9 @@ integer32 MutableStringInternal::compare(const char* other) const
     return this->std::string::compare(other);
 }
 
-integer32 MutableStringInternal::compare(const MutableStringInternal& other) const
+integer32 MutableStringInternal::compare(const StringView& other) const
 {
-    return this->std::string::compare(static_cast<const std::string&>(other));
+    return StringView{ *this }.compare(other);
 }
 
 integer MutableStringInternal::integerValue() const
@@ -214,195 +164,245 @@ const character* MutableStringInternal::asUTF8() const
     return this->c_str();
 }
 
-Blob MutableStringInternal::asUTF16() const
+Blob MutableStringInternal::asUTF16For(const StringView& text)
 {
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    std::u16string u16 = convert.from_bytes(this->c_str());
+    auto characters = reinterpret_cast<const byte*>(text.data());
+    auto length = text.length();
 
-    auto newBlob = Blob::blobWithMemoryAndSize(reinterpret_cast<const byte*>(reinterpret_cast<const integer16*>(u16.c_str())), u16.length() * 2);
-    if (Platform::endianOrder == Platform::LitleEndian) {
-        newBlob = Platform::convertEndiannessOfUInteger16From(newBlob);
+    auto result = MutableBlob::blobWithCapacity(UTF16Transcoder::sizeOfUTF16ForUTF8(characters, length));
+    if (result.size()) {
+        UTF16Transcoder::copyUTF16FromUTF8AndSizeTo(characters, length, result.data());
     }
 
-    return newBlob;
+    return { std::move(result) };
 }
 
-void MutableStringInternal::append(const MutableStringInternal& other)
+void MutableStringInternal::append(const StringView& other)
 {
-    this->std::string::append(other);
+    this->invalidateCachedHash();
+    this->std::string::append(other.data(), other.length());
 }
 
 void MutableStringInternal::append(const character* other)
 {
+    this->invalidateCachedHash();
     this->std::string::append(other);
 }
 
 void MutableStringInternal::append(const character other)
 {
+    this->invalidateCachedHash();
     this->std::string::operator+=(other);
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::stringByAppending(const MutableStringInternal& other) const
-{
-    return {std::make_shared<MutableStringInternal>(*this + other)};
-}
-
-std::vector<String> MutableStringInternal::splitBySeparator(character separator) const
+std::vector<String> MutableStringInternal::splitBySeparatorIn(const StringView& text, character separator)
 {
     std::vector<String> results;
-    std::stringstream stream(this->asUTF8());
-    std::string line;
 
-    while (getline(stream, line, separator)) {
-        results.emplace_back(line);
+    for (auto&& part : text.splitBySeparator(separator)) {
+        results.emplace_back(part);
     }
 
     return results;
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::utfSeek(count skip) const
+StringView MutableStringInternal::utfSeekIn(const StringView& text, count skip)
 {
     NXA_ASSERT_TRUE(skip >= 0);
 
-    if (skip > this->length()) {
-        return {std::make_shared<MutableStringInternal>()};
+    auto length = text.length();
+    if (skip > length) {
+        return { };
     }
 
-    auto rawPointer = this->c_str();
-    auto startPointer = utf8seek(rawPointer, this->length(), rawPointer, skip, SEEK_SET);
+    auto characters = text.data();
+    auto startPointer = utf8seek(characters, length, characters, skip, SEEK_SET);
 
-    return {std::make_shared<MutableStringInternal>(startPointer)};
+    return { startPointer, length - (startPointer - characters) };
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::subString(count start, count end) const
+static NxA::boolean convertCaseOfTextAndSizeTo(const character* text, count length, std::string& result, NxA::boolean toLowerCase)
 {
-    NXA_ASSERT_TRUE(start <= end);
+    // -- Most strings are pure ASCII so runs of ASCII characters are converted directly and only the rest of the text
+    // -- goes through the Unicode case mapping. That mapping looks at the characters around a greek capital sigma so
+    // -- each non-ASCII run is converted along with the ASCII character on each side of it, and short ASCII runs in
+    // -- between non-ASCII ones are converted with them.
+    constexpr count minimumLengthOfASCIIRunToConvertDirectly = 8;
 
-    if ((end == -1) || (end > this->length())) {
-        end = this->length();
-    }
+    auto input = reinterpret_cast<const byte*>(text);
+    auto convertASCIICharacters = toLowerCase ? UTF8Scanner::copyWithLowerCaseASCIICharactersFromAndSizeTo :
+                                                UTF8Scanner::copyWithUpperCaseASCIICharactersFromAndSizeTo;
+    auto convertUnicodeCharacters = toLowerCase ? utf8tolower : utf8toupper;
 
-    if (start >= this->length()) {
-        return {std::make_shared<MutableStringInternal>()};
-    }
+    result.resize(length);
+    count resultLength = 0;
 
-    return {std::make_shared<MutableStringInternal>(this->substr(start, end - start))};
-}
+    count index = 0;
+    while (index < length) {
+        auto nonASCIIStart = index + UTF8Scanner::indexOfFirstNonASCIICharacterIn(input + index, length - index);
+        auto unicodeStart = (nonASCIIStart > index) ? nonASCIIStart - 1 : nonASCIIStart;
+        if (nonASCIIStart == length) {
+            unicodeStart = length;
+        }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::lowerCaseString() const
-{
-    auto inputLength = this->length();
-    if (!inputLength) {
-        return {std::make_shared<MutableStringInternal>()};
+        convertASCIICharacters(input + index, unicodeStart - index, reinterpret_cast<byte*>(&result[resultLength]));
+        resultLength += unicodeStart - index;
+
+        if (unicodeStart == length) {
+            break;
+        }
+
+        auto unicodeEnd = nonASCIIStart;
+        while (unicodeEnd < length) {
+            while ((unicodeEnd < length) && (input[unicodeEnd] & 0x80)) {
+                ++unicodeEnd;
+            }
+
+            auto nextNonASCIIStart = unicodeEnd + UTF8Scanner::indexOfFirstNonASCIICharacterIn(input + unicodeEnd, length - unicodeEnd);
+            if ((nextNonASCIIStart - unicodeEnd) >= minimumLengthOfASCIIRunToConvertDirectly) {
+                ++unicodeEnd;
+                break;
+            }
+
+            unicodeEnd = nextNonASCIIStart;
+        }
+
+        integer32 errors;
+        auto convertedSize = convertUnicodeCharacters(text + unicodeStart, unicodeEnd - unicodeStart, nullptr, 0, UTF8_LOCALE_DEFAULT, &errors);
+        if ((convertedSize == 0) || (errors != UTF8_ERR_NONE)) {
+            return false;
+        }
+
+        result.resize(resultLength + convertedSize + (length - unicodeEnd));
+        if ((convertUnicodeCharacters(text + unicodeStart, unicodeEnd - unicodeStart, &result[resultLength], convertedSize, UTF8_LOCALE_DEFAULT,
+                                      &errors) == 0) ||
+            (errors != UTF8_ERR_NONE)) {
+            return false;
+        }
+
+        resultLength += convertedSize;
+        index = unicodeEnd;
     }
 
-    auto input = this->c_str();
+    result.resize(resultLength);
 
-	count convertedSize;
-	integer32 errors;
+    return true;
+}
 
-	if ((convertedSize = utf8tolower(input, inputLength, NULL, 0, UTF8_LOCALE_DEFAULT, &errors)) == 0 || errors != UTF8_ERR_NONE) {
-		return { std::make_shared<MutableStringInternal>() };
-	}
+static void convertCaseOfString(MutableStringInternal& string, NxA::boolean toLowerCase)
+{
+    auto length = string.length();
+    if (!length) {
+        return;
+    }
 
-	auto converted = static_cast<char*>(alloca(convertedSize + 1));
+    // -- Pure ASCII strings keep their length so they can be converted in place.
+    auto characters = reinterpret_cast<byte*>(&string[0]);
+    if (UTF8Scanner::indexOfFirstNonASCIICharacterIn(characters, length) == length) {
+        if (toLowerCase) {
+            UTF8Scanner::copyWithLowerCaseASCIICharactersFromAndSizeTo(characters, length, characters);
+        }
+        else {
+            UTF8Scanner::copyWithUpperCaseASCIICharactersFromAndSizeTo(characters, length, characters);
+        }
+    }
+    else {
+        std::string converted;
+        if (!convertCaseOfTextAndSizeTo(string.data(), length, converted, toLowerCase)) {
+            converted.clear();
+        }
 
-	if (utf8tolower(input, inputLength, converted, convertedSize, UTF8_LOCALE_DEFAULT, &errors) == 0 || errors != UTF8_ERR_NONE) {
-		return { std::make_shared<MutableStringInternal>() };
-	}
+        string.std::string::operator=(std::move(converted));
+    }
 
-	converted[convertedSize] = 0;
-	
-	return { std::make_shared<MutableStringInternal>(converted, convertedSize) };
+    string.invalidateCachedHash();
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::upperCaseString() const
+std::string MutableStringInternal::lowerCaseStringFor(const StringView& text)
 {
-	auto inputLength = this->length();
-	if (!inputLength) {
-		return { std::make_shared<MutableStringInternal>() };
-	}
+    std::string converted;
+    if (!convertCaseOfTextAndSizeTo(text.data(), text.length(), converted, true)) {
+        return { };
+    }
 
-	auto input = this->c_str();
+    return converted;
+}
 
-	count convertedSize;
-	integer32 errors;
+std::string MutableStringInternal::upperCaseStringFor(const StringView& text)
+{
+    std::string converted;
+    if (!convertCaseOfTextAndSizeTo(text.data(), text.length(), converted, false)) {
+        return { };
+    }
 
-	if ((convertedSize = utf8toupper(input, inputLength, NULL, 0, UTF8_LOCALE_DEFAULT, &errors)) == 0 || errors != UTF8_ERR_NONE) {
-		return { std::make_shared<MutableStringInternal>() };
-	}
+    return converted;
+}
 
-	auto converted = static_cast<char*>(alloca(convertedSize + 1));
+NxA::boolean MutableStringInternal::hasNonPrintableCharactersIn(const StringView& text)
+{
+    auto length = text.length();
+    return UTF8Scanner::indexOfFirstNonPrintableCharacterIn(reinterpret_cast<const byte*>(text.data()), length) != length;
+}
 
-	if (utf8toupper(input, inputLength, converted, convertedSize, UTF8_LOCALE_DEFAULT, &errors) == 0 || errors != UTF8_ERR_NONE) {
-		return { std::make_shared<MutableStringInternal>() };
-	}
+NxA::boolean MutableStringInternal::isValidUTF8In(const StringView& text)
+{
+    return UTF8Scanner::isValidUTF8(reinterpret_cast<const byte*>(text.data()), text.length());
+}
 
-	converted[convertedSize] = 0;
+void MutableStringInternal::convertToLowerCase()
+{
+    convertCaseOfString(*this, true);
+}
 
-	return { std::make_shared<MutableStringInternal>(converted, convertedSize) };
+void MutableStringInternal::convertToUpperCase()
+{
+    convertCaseOfString(*this, false);
 }
 
-NxA::boolean MutableStringInternal::hasPrefix(const MutableStringInternal& prefix) const
+NxA::boolean MutableStringInternal::hasPrefix(const StringView& prefix) const
 {
-    return this->find(prefix) == 0;
+    return StringView{ *this }.hasPrefix(prefix);
 }
 
 NxA::boolean MutableStringInternal::hasPrefix(const character* prefix) const
 {
     NXA_ASSERT_NOT_NULL(prefix);
 
-    return this->find(prefix) == 0;
+    return StringView{ *this }.hasPrefix(StringView::viewWithUTF8(prefix));
 }
 
-NxA::boolean MutableStringInternal::hasPostfix(const MutableStringInternal& postfix) const
+NxA::boolean MutableStringInternal::hasPostfix(const StringView& postfix) const
 {
-    size_t pos = this->find(postfix);
-    if (pos == std::string::npos) {
-        return false;
-    }
-
-    return pos == (this->length() - postfix.length());
+    return StringView{ *this }.hasPostfix(postfix);
 }
 
 NxA::boolean MutableStringInternal::hasPostfix(const character* postfix) const
 {
     NXA_ASSERT_NOT_NULL(postfix);
 
-    size_t pos = this->rfind(postfix);
-    if (pos == std::string::npos) {
-        return false;
-    }
-
-    count length = strlen(postfix);
-    return pos == (this->length() - length);
+    return StringView{ *this }.hasPostfix(StringView::viewWithUTF8(postfix));
 }
 
-NxA::boolean MutableStringInternal::contains(const MutableStringInternal& other) const
+NxA::boolean MutableStringInternal::contains(const StringView& other) const
 {
-    return this->find(other) != std::string::npos;
+    return StringView{ *this }.contains(other);
 }
 
 NxA::boolean MutableStringInternal::contains(const character* other) const
 {
-    return this->find(other) != std::string::npos;
+    NXA_ASSERT_NOT_NULL(other);
+
+    return StringView{ *this }.contains(StringView::viewWithUTF8(other));
 }
 
-std::shared_ptr<MutableStringInternal> MutableStringInternal::stringByFilteringNonPrintableCharactersIn(const String& other)
+std::string MutableStringInternal::stringByFilteringNonPrintableCharactersIn(const String& other)
 {
     std::string filtered;
-    filtered.reserve(other.length());
-
-    const character* input = other.asUTF8();
+    filtered.resize(other.length());
 
-    for (count index = 0; index < other.length(); ++index) {
-        byte value = input[index];
-        if (((value <= 0x1f) && (value != 0x09) && (value != 0x0a) && (value != 0x0d)) || (value == 0x7f)) {
-            continue;
-        }
-
-        filtered += value;
-    }
+    filtered.resize(UTF8Scanner::copyPrintableCharactersFromAndSizeTo(reinterpret_cast<const byte*>(other.asUTF8()),
+                                                                     other.length(),
+                                                                     reinterpret_cast<byte*>(&filtered[0])));
 
-    return {std::make_shared<MutableStringInternal>(std::move(filtered))};
+    return filtered;
 }
@@ -26,11 +26,12 @@
 #include <Base/Optional.hpp>
 #include <Base/Platform.hpp>
 #include <Base/Array.hpp>
+#include <Base/StringView.hpp>
 
+#include <atomic>
 #include <string>
 #include <cstring>
 #include <cstdio>
-#include <codecvt>
 #include <sstream>
 #include <vector>
 #include <utf8rewind/utf8rewind.h>
@@ -53,6 +54,17 @@ class MutableString;
 
 struct MutableStringInternal : public std::string
 {
+    // -- Constants
+    static constexpr uinteger64 cachedHashIsValid = uinteger64(1) << 32;
+
+    // -- Instance Variables
+    // -- Only set on the canonical copies held by the intern table.
+    boolean isInterned = false;
+
+    // -- The hash is computed the first time it is needed and stored along with the cachedHashIsValid flag. Since a
+    // -- String's internal object can be shared between threads, both are stored in the same atomic word.
+    mutable std::atomic<uinteger64> cachedHash{ 0 };
+
     // -- Constructors/Destructors
     MutableStringInternal() : std::string{"", 0} { }
     MutableStringInternal(const std::string& other) : std::string{ other } { }
@@ -62,74 +74,74 @@ struct MutableStringInternal : public std::string
         NXA_ASSERT_NOT_NULL(other);
     }
 
+    // -- Copies are never interned, even if the original was, but they can reuse its hash.
+    MutableStringInternal(const MutableStringInternal& other) : std::string{ other }, cachedHash{ other.cachedHash.load(std::memory_order_relaxed) } { }
+    MutableStringInternal(MutableStringInternal&& other)
+        : std::string{ std::move(other) }, cachedHash{ other.cachedHash.exchange(0, std::memory_order_relaxed) } { }
     ~MutableStringInternal() = default;
 
-    template <typename... Args>
-    static MutableStringInternal stringWithFormat(count sizeGuess, const character* format, Args&&... args)
-    {
-        NXA_ASSERT_NOT_NULL(format);
-        NXA_ASSERT_TRUE((sizeGuess > 1) && (sizeGuess < std::numeric_limits<count>::max()));
-        auto finalStringLength = 0;
-
-        {
-            std::string buffer;
-            buffer.resize(sizeGuess);
-
-            // -- safe to use snprintf instead of vsnprintf because buffer is unique
-            finalStringLength = std::snprintf(&buffer[0], sizeGuess, format, args...);
-
-            NXA_ASSERT_FALSE(finalStringLength < 0 || finalStringLength >= std::numeric_limits<count>::max());
+    // -- Factory Methods
+    // -- These return the characters of the new string, so that String can store short ones inline instead of
+    // -- allocating an internal object for them.
+    static std::string stringWithRepeatedCharacter(count number, character specificCharacter);
 
-            if (finalStringLength < sizeGuess) {
-                buffer.resize(finalStringLength);
-                return MutableStringInternal{std::move(buffer)};
-            }
-        }
+    static std::string stringWithUTF16AtAndSize(const byte* data, count size);
 
-        // -- guess was too small, redo with the exact correct size
-        return stringWithFormat(finalStringLength + 1, format, std::forward<Args>(args)...);
-    }
+	static std::string stringWithUTF16(const Blob& other);
 
-    static std::shared_ptr<MutableStringInternal> stringWithRepeatedCharacter(count number, character specificCharacter);
+	static std::string stringWithUTF16(const wchar_t* other, count size);
 
-    static std::shared_ptr<MutableStringInternal> stringWithUTF16AtAndSize(const byte* data, count size);
+    static std::string stringByFilteringNonPrintableCharactersIn(const String& other);
 
-	static std::shared_ptr<MutableStringInternal> stringWithUTF16(const Blob& other);
+    // -- Class Methods
+    // -- These work on the characters of any string, including the ones String stores inline.
+    static Blob asUTF16For(const StringView& text);
 
-	static std::shared_ptr<MutableStringInternal> stringWithUTF16(const wchar_t* other, count size);
+    static std::vector<String> splitBySeparatorIn(const StringView& text, character separator);
 
-    static std::shared_ptr<MutableStringInternal> stringByFilteringNonPrintableCharactersIn(const String& other);
+    static StringView utfSeekIn(const StringView& text, count skip);
 
-    template <typename ArrayType>
-    static std::shared_ptr<MutableStringInternal> stringByJoiningArrayWithString(const ArrayType& array, MutableStringInternal& join)
-    {
-        std::string result;
+    static std::string lowerCaseStringFor(const StringView& text);
 
-        auto iterator = array.begin();
-        while (iterator != array.end()) {
-            result.append(iterator->asStdString());
+    static std::string upperCaseStringFor(const StringView& text);
 
-            if (++iterator != array.end()) {
-                result.append(join.asStdString());
-            }
-        }
+    static boolean hasNonPrintableCharactersIn(const StringView& text);
 
-        return std::make_shared<MutableStringInternal>(std::move(result));
-    }
+    static boolean isValidUTF8In(const StringView& text);
 
     // -- Operators
+    MutableStringInternal& operator=(const MutableStringInternal& other)
+    {
+        this->std::string::operator=(other);
+        this->isInterned = false;
+        this->cachedHash.store(other.cachedHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+    MutableStringInternal& operator=(MutableStringInternal&& other)
+    {
+        this->std::string::operator=(std::move(other));
+        this->isInterned = false;
+        this->cachedHash.store(other.cachedHash.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
     bool operator==(const character* other) const;
-    bool operator==(const MutableStringInternal& other) const;
+    bool operator==(const StringView& other) const;
 
     // -- Instance Methods
     count length() const;
 
     integer32 compare(const char* other) const;
 
-    integer32 compare(const MutableStringInternal& other) const;
+    integer32 compare(const StringView& other) const;
 
     uinteger32 hash() const;
 
+    // -- Must be called by any method modifying the content of the string.
+    void invalidateCachedHash()
+    {
+        this->cachedHash.store(0, std::memory_order_relaxed);
+    }
+
     integer integerValue() const;
 
     decimal3 decimalValue() const;
@@ -138,40 +150,28 @@ struct MutableStringInternal : public std::string
 
     const character* asUTF8() const;
 
-    Blob asUTF16() const;
-
-    void append(const MutableStringInternal& other);
+    void append(const StringView& other);
 
     void append(const character* other);
 
     void append(const character other);
 
-    std::shared_ptr<MutableStringInternal> stringByAppending(const MutableStringInternal& other) const;
-
-    std::vector<String> splitBySeparator(character separator) const;
-
-    std::shared_ptr<MutableStringInternal> utfSeek(count skip) const;
-
-    std::shared_ptr<MutableStringInternal> subString(count start, count end) const;
+    void convertToLowerCase();
 
-    std::shared_ptr<MutableStringInternal> lowerCaseString() const;
+    void convertToUpperCase();
 
-    std::shared_ptr<MutableStringInternal> upperCaseString() const;
-
-    boolean hasPrefix(const MutableStringInternal& prefix) const;
+    boolean hasPrefix(const StringView& prefix) const;
 
     boolean hasPrefix(const character* prefix) const;
 
-    boolean hasPostfix(const MutableStringInternal& postfix) const;
+    boolean hasPostfix(const StringView& postfix) const;
 
     boolean hasPostfix(const character* postfix) const;
 
-    boolean contains(const MutableStringInternal& other) const;
+    boolean contains(const StringView& other) const;
 
     boolean contains(const character* other) const;
 
-    boolean hasNonPrintableCharacters() const;
-
     count indexOfFirstOccurenceOf(const String& other) const;
     count indexOfFirstOccurenceOf(const character* other) const;
     count indexOfLastOccurenceOf(const String& other) const;
@@ -179,33 +179,11 @@ struct MutableStringInternal : public std::string
 
     void replaceOccurenceOfStringWith(const character* occurence, const character* replacement);
 
-    virtual const character* className() const final
+    const character* className() const
     {
         NXA_ALOG("Illegal call.");
         return nullptr;
     }
-
-    template <typename T>
-    static T stringArgumentAsCharacter(T&& t)
-    {
-        return t;
-    }
-    template <typename T>
-    static const character* stringArgumentAsCharacter(Optional<T> t)
-    {
-        if (!t) {
-            return "<nothing>";
-        }
-        return stringArgumentAsCharacter(*t);
-    }
-    static const character* stringArgumentAsCharacter(const std::string& cppstring);
-    static const character* stringArgumentAsCharacter(const String& nxastring);
-    static const character* stringArgumentAsCharacter(const MutableString& nxastring);
-    static const character* stringArgumentAsCharacter(const MutableStringInternal& nxastring);
-    static const character* stringArgumentAsCharacter(std::string& cppstring);
-    static const character* stringArgumentAsCharacter(String& nxastring);
-    static const character* stringArgumentAsCharacter(MutableString& nxastring);
-    static const character* stringArgumentAsCharacter(MutableStringInternal& nxastring);
 };
     
 }
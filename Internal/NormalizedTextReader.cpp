@@ -0,0 +1,269 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/Internal/NormalizedTextReader.hpp"
+#include "Base/Internal/UTF8Scanner.hpp"
+
+#include <utf8rewind/utf8rewind.h>
+
+using namespace NxA;
+
+// -- Constants
+
+constexpr count NormalizedTextReader::maximumLengthOfFoldedASCIIChunks;
+
+// -- Private Functions
+
+static inline uinteger64 readUInteger64At(const byte* pointer)
+{
+    uinteger64 value;
+    ::memcpy(&value, pointer, sizeof(value));
+    return value;
+}
+
+// -- Lower cases the upper case letters in a word made only of ASCII characters.
+static inline uinteger64 lowerCaseASCIIWord(uinteger64 word)
+{
+    constexpr uinteger64 ones = 0x0101010101010101ULL;
+    constexpr uinteger64 highBits = 0x8080808080808080ULL;
+
+    auto isAtLeastA = (word + (ones * (0x80 - 'A'))) & highBits;
+    auto isAboveZ = (word + (ones * (0x80 - 'Z' - 1))) & highBits;
+
+    return word | ((isAtLeastA & ~isAboveZ) >> 2);
+}
+
+// -- Returns true if the text only contains Latin-1 characters, and none of the ones which can be decomposed. These
+// -- are the most common non-ASCII characters and checking them here is much faster than looking them up in the
+// -- Unicode database.
+static inline boolean isMadeOfLatin1CharactersWithoutDecompositions(const character* text, count length)
+{
+    // -- One bit per second byte of the characters encoded as 0xc3 0x80 to 0xc3 0xbf (U+00C0 to U+00FF), set for
+    // -- the ones without a decomposition like Æ, Ø or ß. Characters encoded with 0xc2 never have one.
+    constexpr uinteger64 charactersWithoutDecompositionsAfter0xc3 = 0x41810040c1810040ULL;
+
+    if (length & 1) {
+        return false;
+    }
+
+    auto characters = reinterpret_cast<const byte*>(text);
+    for (count index = 0; index < length; index += 2) {
+        auto leadingByte = characters[index];
+        auto secondByte = characters[index + 1];
+        if ((secondByte & 0xc0) != 0x80) {
+            return false;
+        }
+
+        if (leadingByte == 0xc3) {
+            if (!((charactersWithoutDecompositionsAfter0xc3 >> (secondByte & 0x3f)) & 1)) {
+                return false;
+            }
+        }
+        else if (leadingByte != 0xc2) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -- Class Methods
+
+integer32 NormalizedTextReader::compareNormalizedFormsOf(const StringView& first, const StringView& second, boolean foldCase)
+{
+    // -- Most texts are ASCII so they are compared directly until the first non-ASCII character.
+    auto firstCharacters = reinterpret_cast<const byte*>(first.data());
+    auto secondCharacters = reinterpret_cast<const byte*>(second.data());
+    auto shortestLength = std::min(first.length(), second.length());
+
+    count index = 0;
+    for (; (index + 8) <= shortestLength; index += 8) {
+        auto firstWord = readUInteger64At(firstCharacters + index);
+        auto secondWord = readUInteger64At(secondCharacters + index);
+        if ((firstWord | secondWord) & 0x8080808080808080ULL) {
+            break;
+        }
+
+        if ((firstWord != secondWord) && (!foldCase || (lowerCaseASCIIWord(firstWord) != lowerCaseASCIIWord(secondWord)))) {
+            break;
+        }
+    }
+
+    for (; index < shortestLength; ++index) {
+        byte firstValue = firstCharacters[index];
+        byte secondValue = secondCharacters[index];
+        if ((firstValue | secondValue) & 0x80) {
+            break;
+        }
+
+        if (foldCase) {
+            firstValue = ((firstValue >= 'A') && (firstValue <= 'Z')) ? (firstValue ^ 0x20) : firstValue;
+            secondValue = ((secondValue >= 'A') && (secondValue <= 'Z')) ? (secondValue ^ 0x20) : secondValue;
+        }
+
+        if (firstValue != secondValue) {
+            return (firstValue < secondValue) ? -1 : 1;
+        }
+    }
+
+    if (index == shortestLength) {
+        return (first.length() == second.length()) ? 0 : ((first.length() < second.length()) ? -1 : 1);
+    }
+
+    // -- Everything before index is ASCII, which normalization leaves alone, so the rest can be normalized on its own.
+    NormalizedTextReader firstReader{ first.subString(index), foldCase };
+    NormalizedTextReader secondReader{ second.subString(index), foldCase };
+
+    StringView firstChunk;
+    StringView secondChunk;
+    while (true) {
+        if (firstChunk.isEmpty()) {
+            firstChunk = firstReader.nextChunk();
+        }
+        if (secondChunk.isEmpty()) {
+            secondChunk = secondReader.nextChunk();
+        }
+
+        if (firstChunk.isEmpty() || secondChunk.isEmpty()) {
+            return firstChunk.isEmpty() ? (secondChunk.isEmpty() ? 0 : -1) : 1;
+        }
+
+        auto lengthToCompare = std::min(firstChunk.length(), secondChunk.length());
+        auto result = ::memcmp(firstChunk.data(), secondChunk.data(), lengthToCompare);
+        if (result) {
+            return (result < 0) ? -1 : 1;
+        }
+
+        firstChunk = firstChunk.subString(lengthToCompare);
+        secondChunk = secondChunk.subString(lengthToCompare);
+    }
+}
+
+std::string NormalizedTextReader::normalizedFormOf(const StringView& text, boolean foldCase)
+{
+    std::string result;
+    result.reserve(text.length());
+
+    NormalizedTextReader reader{ text, foldCase };
+    for (auto chunk = reader.nextChunk(); !chunk.isEmpty(); chunk = reader.nextChunk()) {
+        result.append(chunk.data(), chunk.length());
+    }
+
+    return result;
+}
+
+boolean NormalizedTextReader::isInNormalizedForm(const StringView& text)
+{
+    auto characters = text.data();
+    auto length = text.length();
+
+    count index = 0;
+    while (index < length) {
+        index += UTF8Scanner::indexOfFirstNonASCIICharacterIn(reinterpret_cast<const byte*>(characters + index), length - index);
+        if (index == length) {
+            break;
+        }
+
+        // -- Like in nextChunk(), each run of non-ASCII characters can be checked on its own.
+        count chunkLength = 1;
+        while (((index + chunkLength) < length) && (characters[index + chunkLength] & 0x80)) {
+            ++chunkLength;
+        }
+
+        if (!isMadeOfLatin1CharactersWithoutDecompositions(characters + index, chunkLength) &&
+            (utf8isnormalized(characters + index, chunkLength, UTF8_NORMALIZE_DECOMPOSE, nullptr) != UTF8_NORMALIZATION_RESULT_YES)) {
+            return false;
+        }
+
+        index += chunkLength;
+    }
+
+    return true;
+}
+
+// -- Instance Methods
+
+StringView NormalizedTextReader::nextChunk()
+{
+    auto input = this->text + this->position;
+    auto remainingLength = this->length - this->position;
+    if (!remainingLength) {
+        return { };
+    }
+
+    auto asciiLength = UTF8Scanner::indexOfFirstNonASCIICharacterIn(reinterpret_cast<const byte*>(input), remainingLength);
+    if (asciiLength) {
+        if (!this->foldCase) {
+            this->position += asciiLength;
+            return { input, asciiLength };
+        }
+
+        if (asciiLength > NormalizedTextReader::maximumLengthOfFoldedASCIIChunks) {
+            asciiLength = NormalizedTextReader::maximumLengthOfFoldedASCIIChunks;
+        }
+
+        UTF8Scanner::copyWithLowerCaseASCIICharactersFromAndSizeTo(reinterpret_cast<const byte*>(input),
+                                                                   asciiLength,
+                                                                   reinterpret_cast<byte*>(this->foldedASCIICharacters));
+        this->position += asciiLength;
+        return { this->foldedASCIICharacters, asciiLength };
+    }
+
+    count chunkLength = 1;
+    while ((chunkLength < remainingLength) && (input[chunkLength] & 0x80)) {
+        ++chunkLength;
+    }
+
+    this->position += chunkLength;
+
+    const character* source = input;
+    count sourceLength = chunkLength;
+    integer32 errors;
+
+    if (this->foldCase) {
+        // -- Case folding never makes a character more than three times longer.
+        this->foldedCharacters.resize(chunkLength * 3);
+        auto foldedLength = utf8casefold(input, chunkLength, &this->foldedCharacters[0], this->foldedCharacters.length(), UTF8_LOCALE_DEFAULT, &errors);
+        if (foldedLength && (errors == UTF8_ERR_NONE)) {
+            source = this->foldedCharacters.data();
+            sourceLength = foldedLength;
+        }
+    }
+
+    if (isMadeOfLatin1CharactersWithoutDecompositions(source, sourceLength) ||
+        (utf8isnormalized(source, sourceLength, UTF8_NORMALIZE_DECOMPOSE, nullptr) == UTF8_NORMALIZATION_RESULT_YES)) {
+        return { source, sourceLength };
+    }
+
+    // -- Decomposition never makes a UTF8 text more than three times longer so it is normalized in a single pass
+    // -- into a buffer that is large enough, instead of computing the exact length first.
+    if (this->normalizedCharacters.length() < (sourceLength * 3)) {
+        this->normalizedCharacters.resize(sourceLength * 3);
+    }
+
+    auto normalizedLength = utf8normalize(source, sourceLength, &this->normalizedCharacters[0], this->normalizedCharacters.length(),
+                                          UTF8_NORMALIZE_DECOMPOSE, &errors);
+    if (!normalizedLength || (errors != UTF8_ERR_NONE)) {
+        return { source, sourceLength };
+    }
+
+    return { this->normalizedCharacters.data(), normalizedLength };
+}
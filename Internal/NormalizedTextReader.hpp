@@ -0,0 +1,68 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Uncopyable.hpp>
+#include <Base/StringView.hpp>
+
+#include <string>
+
+namespace NxA {
+
+// -- Reads the decomposed (NFD) form of a UTF8 text one chunk at a time, case folding it first if needed. Texts can
+// -- then be compared or copied without normalizing them as a whole. Chunks always end before an ASCII character,
+// -- where normalization can't depend on the characters that follow, and runs of ASCII characters are returned
+// -- as is since they are never changed by decomposition.
+class NormalizedTextReader : private Uncopyable
+{
+    // -- Private Constants
+    static constexpr count maximumLengthOfFoldedASCIIChunks = 64;
+
+    // -- Private Instance Variables
+    const character* text;
+    count length;
+    count position = 0;
+    boolean foldCase;
+
+    character foldedASCIICharacters[maximumLengthOfFoldedASCIIChunks];
+    std::string foldedCharacters;
+    std::string normalizedCharacters;
+
+public:
+    // -- Constructors/Destructors
+    NormalizedTextReader(const StringView& withText, boolean withFoldCase)
+        : text{ withText.data() }, length{ withText.length() }, foldCase{ withFoldCase } { }
+
+    // -- Class Methods
+    static integer32 compareNormalizedFormsOf(const StringView&, const StringView&, boolean);
+    static std::string normalizedFormOf(const StringView&, boolean);
+
+    // -- Checks if a text is already decomposed, without case folding it, and without copying or normalizing anything.
+    static boolean isInNormalizedForm(const StringView&);
+
+    // -- Instance Methods
+    // -- The chunk is only valid until the next call. Returns an empty chunk once the whole text has been read.
+    StringView nextChunk();
+};
+
+}
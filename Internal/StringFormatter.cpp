@@ -0,0 +1,586 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/Internal/StringFormatter.hpp"
+#include "Base/String.hpp"
+#include "Base/MutableString.hpp"
+
+#include <cstdio>
+#include <functional>
+
+using namespace NxA;
+
+// -- Private Types
+
+namespace {
+
+struct ConversionSpecification
+{
+    boolean isLeftJustified = false;
+    boolean alwaysHasASign = false;
+    boolean hasASpaceInsteadOfAPlusSign = false;
+    boolean usesTheAlternateForm = false;
+    boolean isPaddedWithZeros = false;
+
+    count width = 0;
+
+    // -- A negative precision means that none was given.
+    integer precision = -1;
+
+    character conversion = 0;
+
+    boolean hasNoFlagsOrSizes() const
+    {
+        return !this->isLeftJustified && !this->alwaysHasASign && !this->hasASpaceInsteadOfAPlusSign &&
+               !this->usesTheAlternateForm && !this->isPaddedWithZeros && (this->width == 0) && (this->precision < 0);
+    }
+};
+
+}
+
+// -- Private Functions
+
+static const FormatArgument& nextArgumentIn(const FormatArgument*& arguments)
+{
+    NXA_ASSERT_TRUE(arguments->argumentKind() != FormatArgument::Kind::EndOfArguments);
+    return *arguments++;
+}
+
+static void padTextStartingAtWith(std::string& result, count start, const ConversionSpecification& specification)
+{
+    auto length = result.length() - start;
+    if (specification.width <= length) {
+        return;
+    }
+
+    auto padding = specification.width - length;
+    if (specification.isLeftJustified) {
+        result.append(padding, ' ');
+    }
+    else {
+        result.insert(start, padding, ' ');
+    }
+}
+
+static void appendTextWith(std::string& result, const character* text, count length, const ConversionSpecification& specification)
+{
+    if ((specification.precision >= 0) && (static_cast<count>(specification.precision) < length)) {
+        length = specification.precision;
+    }
+
+    auto padding = (specification.width > length) ? specification.width - length : 0;
+    if (!specification.isLeftJustified) {
+        result.append(padding, ' ');
+    }
+
+    result.append(text, length);
+
+    if (specification.isLeftJustified) {
+        result.append(padding, ' ');
+    }
+}
+
+static void appendIntegerTo(std::string& result, uinteger64 value, boolean isNegative)
+{
+    character digits[24];
+    auto end = digits + sizeof(digits);
+    auto start = end;
+
+    do {
+        *--start = static_cast<character>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    if (isNegative) {
+        *--start = '-';
+    }
+
+    result.append(start, end - start);
+}
+
+static void appendSignedIntegerTo(std::string& result, integer64 value)
+{
+    // -- Negating as an unsigned value also works for the smallest negative integer.
+    appendIntegerTo(result, (value < 0) ? 0 - static_cast<uinteger64>(value) : static_cast<uinteger64>(value), value < 0);
+}
+
+static void appendDecimalTo(std::string& result, integer64 unbiasedValue, count precision)
+{
+    uinteger64 factor = 1;
+    for (count index = 0; index < precision; ++index) {
+        factor *= 10;
+    }
+
+    auto isNegative = unbiasedValue < 0;
+    auto magnitude = isNegative ? 0 - static_cast<uinteger64>(unbiasedValue) : static_cast<uinteger64>(unbiasedValue);
+    appendIntegerTo(result, magnitude / factor, isNegative);
+
+    if (precision == 0) {
+        return;
+    }
+
+    result.push_back('.');
+
+    auto start = result.length();
+    result.append(precision, '0');
+
+    auto fraction = magnitude % factor;
+    for (auto index = result.length(); (fraction != 0) && (index > start); fraction /= 10) {
+        result[--index] = static_cast<character>('0' + (fraction % 10));
+    }
+}
+
+template <typename... Arguments>
+static void appendPrintedTo(std::string& result, const character* format, Arguments... arguments)
+{
+    // -- We print straight into the result, most numbers fit in the first guess and the others are printed again.
+    constexpr count firstGuess = 64;
+
+    auto start = result.length();
+    result.resize(start + firstGuess);
+
+    auto length = std::snprintf(&result[start], firstGuess, format, arguments...);
+    NXA_ASSERT_TRUE(length >= 0);
+
+    if (static_cast<count>(length) >= firstGuess) {
+        // -- snprintf only ever writes the null terminator in the string's own terminator.
+        result.resize(start + length);
+        std::snprintf(&result[start], length + 1, format, arguments...);
+    }
+
+    result.resize(start + length);
+}
+
+static void makeFormatFor(character* format, const ConversionSpecification& specification)
+{
+    *format++ = '%';
+
+    if (specification.isLeftJustified) {
+        *format++ = '-';
+    }
+    if (specification.alwaysHasASign) {
+        *format++ = '+';
+    }
+    if (specification.hasASpaceInsteadOfAPlusSign) {
+        *format++ = ' ';
+    }
+    if (specification.usesTheAlternateForm) {
+        *format++ = '#';
+    }
+    if (specification.isPaddedWithZeros) {
+        *format++ = '0';
+    }
+
+    // -- Width and precision are always given as arguments, a negative precision is ignored by snprintf.
+    *format++ = '*';
+    *format++ = '.';
+    *format++ = '*';
+
+    *format++ = specification.conversion;
+    *format = 0;
+}
+
+static void appendNaturalFormOfTo(std::string& result, const FormatArgument& argument)
+{
+    switch (argument.argumentKind()) {
+        case FormatArgument::Kind::Signed: {
+            appendSignedIntegerTo(result, argument.asSignedInteger());
+            break;
+        }
+        case FormatArgument::Kind::Unsigned: {
+            appendIntegerTo(result, argument.asUnsignedInteger(), false);
+            break;
+        }
+        case FormatArgument::Kind::FloatingPoint: {
+            appendPrintedTo(result, "%g", argument.asFloatingPoint());
+            break;
+        }
+        case FormatArgument::Kind::Decimal: {
+            appendDecimalTo(result, argument.asSignedInteger(), argument.decimalPrecision());
+            break;
+        }
+        case FormatArgument::Kind::Text: {
+            result.append(argument.textCharacters(), argument.textLength());
+            break;
+        }
+        case FormatArgument::Kind::Pointer: {
+            appendPrintedTo(result, "%p", argument.asPointer());
+            break;
+        }
+        case FormatArgument::Kind::Nothing: {
+            result.append("<nothing>");
+            break;
+        }
+        case FormatArgument::Kind::EndOfArguments: {
+            NXA_ALOG("Missing format argument.");
+        }
+    }
+}
+
+static void appendIntegerWith(std::string& result, const FormatArgument& argument, const ConversionSpecification& specification)
+{
+    NXA_ASSERT_TRUE(argument.isAnInteger());
+
+    auto conversion = specification.conversion;
+    if (conversion == 'c') {
+        character value = static_cast<character>(argument.asUnsignedInteger());
+        ConversionSpecification textSpecification = specification;
+        textSpecification.precision = -1;
+        appendTextWith(result, &value, 1, textSpecification);
+        return;
+    }
+
+    auto isASignedConversion = (conversion == 'd') || (conversion == 'i');
+    if (isASignedConversion && specification.hasNoFlagsOrSizes()) {
+        appendNaturalFormOfTo(result, argument);
+        return;
+    }
+
+    uinteger64 value;
+    boolean isNegative = false;
+    if (isASignedConversion) {
+        value = argument.asUnsignedInteger();
+        if ((argument.argumentKind() == FormatArgument::Kind::Signed) && (argument.asSignedInteger() < 0)) {
+            isNegative = true;
+            value = 0 - value;
+        }
+    }
+    else {
+        // -- Like printf, unsigned conversions see negative values as the unsigned type of the same size.
+        value = argument.asUnsignedInteger();
+        auto size = argument.integerSize();
+        if (size < sizeof(uinteger64)) {
+            value &= (uinteger64{ 1 } << (size * 8)) - 1;
+        }
+
+        if ((conversion == 'u') && specification.hasNoFlagsOrSizes()) {
+            appendIntegerTo(result, value, false);
+            return;
+        }
+    }
+
+    uinteger64 base = ((conversion == 'x') || (conversion == 'X')) ? 16 : ((conversion == 'o') ? 8 : 10);
+    auto digitCharacters = (conversion == 'X') ? "0123456789ABCDEF" : "0123456789abcdef";
+    auto isZero = (value == 0);
+
+    character digits[24];
+    auto end = digits + sizeof(digits);
+    auto start = end;
+
+    // -- Like printf, a precision of zero writes no digits at all for a value of zero.
+    if (!isZero || (specification.precision != 0)) {
+        do {
+            *--start = digitCharacters[value % base];
+            value /= base;
+        } while (value != 0);
+    }
+
+    count numberOfDigits = end - start;
+    count numberOfLeadingZeros = ((specification.precision >= 0) && (static_cast<count>(specification.precision) > numberOfDigits)) ?
+                                 specification.precision - numberOfDigits : 0;
+
+    const character* prefix = "";
+    if (isNegative) {
+        prefix = "-";
+    }
+    else if (isASignedConversion && specification.alwaysHasASign) {
+        prefix = "+";
+    }
+    else if (isASignedConversion && specification.hasASpaceInsteadOfAPlusSign) {
+        prefix = " ";
+    }
+    else if (specification.usesTheAlternateForm && (base == 16) && !isZero) {
+        prefix = (conversion == 'X') ? "0X" : "0x";
+    }
+    else if (specification.usesTheAlternateForm && (base == 8) && (numberOfLeadingZeros == 0) && ((numberOfDigits == 0) || (*start != '0'))) {
+        numberOfLeadingZeros = 1;
+    }
+
+    auto prefixLength = ::strlen(prefix);
+    auto length = prefixLength + numberOfLeadingZeros + numberOfDigits;
+    auto padding = (specification.width > length) ? specification.width - length : 0;
+
+    // -- Padding with zeros is ignored when the number is left-justified or has a precision.
+    if (specification.isPaddedWithZeros && !specification.isLeftJustified && (specification.precision < 0)) {
+        numberOfLeadingZeros += padding;
+        padding = 0;
+    }
+
+    if (!specification.isLeftJustified) {
+        result.append(padding, ' ');
+    }
+
+    result.append(prefix, prefixLength);
+    result.append(numberOfLeadingZeros, '0');
+    result.append(start, numberOfDigits);
+
+    if (specification.isLeftJustified) {
+        result.append(padding, ' ');
+    }
+}
+
+static void appendFloatingPointWith(std::string& result, const FormatArgument& argument, const ConversionSpecification& specification)
+{
+    NXA_ASSERT_TRUE(argument.isANumber());
+
+    double value;
+    switch (argument.argumentKind()) {
+        case FormatArgument::Kind::Signed: {
+            value = static_cast<double>(argument.asSignedInteger());
+            break;
+        }
+        case FormatArgument::Kind::Unsigned: {
+            value = static_cast<double>(argument.asUnsignedInteger());
+            break;
+        }
+        case FormatArgument::Kind::Decimal: {
+            value = static_cast<double>(argument.asSignedInteger());
+            for (count index = 0; index < argument.decimalPrecision(); ++index) {
+                value /= 10;
+            }
+            break;
+        }
+        default: {
+            value = argument.asFloatingPoint();
+            break;
+        }
+    }
+
+    character format[16];
+    makeFormatFor(format, specification);
+    appendPrintedTo(result, format, static_cast<int>(specification.width), specification.precision, value);
+}
+
+static void appendArgumentWith(std::string& result, const FormatArgument& argument, const ConversionSpecification& specification)
+{
+    if (argument.argumentKind() == FormatArgument::Kind::Nothing) {
+        appendTextWith(result, "<nothing>", 9, specification);
+        return;
+    }
+
+    switch (specification.conversion) {
+        case 's': {
+            if (argument.argumentKind() == FormatArgument::Kind::Text) {
+                appendTextWith(result, argument.textCharacters(), argument.textLength(), specification);
+            }
+            else {
+                auto start = result.length();
+                appendNaturalFormOfTo(result, argument);
+                padTextStartingAtWith(result, start, specification);
+            }
+            break;
+        }
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c': {
+            appendIntegerWith(result, argument, specification);
+            break;
+        }
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            appendFloatingPointWith(result, argument, specification);
+            break;
+        }
+        case 'p': {
+            NXA_ASSERT_TRUE(argument.argumentKind() == FormatArgument::Kind::Pointer);
+            auto start = result.length();
+            appendPrintedTo(result, "%p", argument.asPointer());
+            padTextStartingAtWith(result, start, specification);
+            break;
+        }
+        default: {
+            NXA_ALOG("Unsupported format conversion '%c'.", specification.conversion);
+        }
+    }
+}
+
+static count sizeNeededForArgument(const FormatArgument& argument)
+{
+    // -- This is only a guess for numbers but it is exact for text, which is usually the largest part of the result.
+    if (argument.argumentKind() == FormatArgument::Kind::Text) {
+        return argument.textLength();
+    }
+
+    return 8;
+}
+
+static boolean textIsInsideOf(const character* text, const std::string& other)
+{
+    std::less_equal<const character*> isBeforeOrAt;
+    return isBeforeOrAt(other.data(), text) && isBeforeOrAt(text, other.data() + other.capacity());
+}
+
+static count numberParsedAt(const character*& position, const character* end)
+{
+    count result = 0;
+    while ((position != end) && (*position >= '0') && (*position <= '9')) {
+        result = (result * 10) + (*position++ - '0');
+    }
+
+    return result;
+}
+
+// -- Constructors/Destructors
+
+FormatArgument::FormatArgument(const String& value) : textValue{ value.asUTF8() }, lengthOfText{ value.length() }, kind{ Kind::Text } { }
+
+FormatArgument::FormatArgument(const MutableString& value)
+    : textValue{ value.asUTF8() }, lengthOfText{ value.length() }, kind{ Kind::Text } { }
+
+// -- Class Methods
+
+void StringFormatter::appendFormattedArgumentsTo(std::string& result, const StringView& format, const FormatArgument* arguments)
+{
+    auto neededSize = result.length() + format.length();
+
+    // -- The format or the arguments can be the characters of the result itself, which can move when the result grows.
+    auto usesTheResult = textIsInsideOf(format.data(), result);
+
+    for (auto argument = arguments; argument->argumentKind() != FormatArgument::Kind::EndOfArguments; ++argument) {
+        neededSize += sizeNeededForArgument(*argument);
+        usesTheResult = usesTheResult || ((argument->argumentKind() == FormatArgument::Kind::Text) && textIsInsideOf(argument->textCharacters(), result));
+    }
+
+    if (usesTheResult) {
+        std::string formatted;
+        StringFormatter::appendFormattedArgumentsTo(formatted, format, arguments);
+        result.append(formatted);
+        return;
+    }
+
+    // -- Strings appended to over and over still need to grow geometrically.
+    if (neededSize > result.capacity()) {
+        result.reserve(std::max(neededSize, result.capacity() * 2));
+    }
+
+    auto position = format.data();
+    auto end = position + format.length();
+
+    while (position != end) {
+        auto percentSign = static_cast<const character*>(::memchr(position, '%', end - position));
+        if (percentSign == nullptr) {
+            result.append(position, end - position);
+            break;
+        }
+
+        result.append(position, percentSign - position);
+        position = percentSign + 1;
+        NXA_ASSERT_TRUE(position != end);
+
+        if (*position == '%') {
+            result.push_back('%');
+            ++position;
+            continue;
+        }
+
+        ConversionSpecification specification;
+
+        for (boolean isAFlag = true; isAFlag && (position != end); ) {
+            switch (*position) {
+                case '-': {
+                    specification.isLeftJustified = true;
+                    break;
+                }
+                case '+': {
+                    specification.alwaysHasASign = true;
+                    break;
+                }
+                case ' ': {
+                    specification.hasASpaceInsteadOfAPlusSign = true;
+                    break;
+                }
+                case '#': {
+                    specification.usesTheAlternateForm = true;
+                    break;
+                }
+                case '0': {
+                    specification.isPaddedWithZeros = true;
+                    break;
+                }
+                default: {
+                    isAFlag = false;
+                    continue;
+                }
+            }
+
+            ++position;
+        }
+
+        if ((position != end) && (*position == '*')) {
+            ++position;
+
+            auto& width = nextArgumentIn(arguments);
+            NXA_ASSERT_TRUE(width.isAnInteger());
+
+            // -- Like printf, a negative width means the text is left-justified.
+            auto value = width.asSignedInteger();
+            if ((width.argumentKind() == FormatArgument::Kind::Signed) && (value < 0)) {
+                specification.isLeftJustified = true;
+                value = -value;
+            }
+
+            specification.width = static_cast<count>(value);
+        }
+        else {
+            specification.width = numberParsedAt(position, end);
+        }
+
+        if ((position != end) && (*position == '.')) {
+            ++position;
+
+            if ((position != end) && (*position == '*')) {
+                ++position;
+
+                auto& precision = nextArgumentIn(arguments);
+                NXA_ASSERT_TRUE(precision.isAnInteger());
+
+                auto value = precision.asSignedInteger();
+                specification.precision = ((precision.argumentKind() == FormatArgument::Kind::Signed) && (value < 0)) ? -1 :
+                                          static_cast<integer>(value);
+            }
+            else {
+                specification.precision = static_cast<integer>(numberParsedAt(position, end));
+            }
+        }
+
+        // -- Length modifiers are not needed since arguments know their own type.
+        while ((position != end) && ::strchr("hlLqjzt", *position) && (*position != 0)) {
+            ++position;
+        }
+
+        NXA_ASSERT_TRUE(position != end);
+        specification.conversion = *position++;
+
+        appendArgumentWith(result, nextArgumentIn(arguments), specification);
+    }
+
+    NXA_ASSERT_TRUE(arguments->argumentKind() == FormatArgument::Kind::EndOfArguments);
+}
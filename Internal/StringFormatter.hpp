@@ -0,0 +1,177 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Optional.hpp>
+#include <Base/StringView.hpp>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace NxA {
+
+// -- Forward Declarations
+class String;
+class MutableString;
+
+// -- One argument given to a format string. Arguments only ever point to the characters of strings, which must
+// -- therefore outlive the argument, and remember what kind of value they were created from so that a conversion
+// -- which does not match its argument can be caught instead of reading garbage like snprintf would.
+class FormatArgument
+{
+public:
+    // -- Types
+    enum class Kind {
+        Signed,
+        Unsigned,
+        FloatingPoint,
+        Decimal,
+        Text,
+        Pointer,
+        Nothing,
+        EndOfArguments
+    };
+
+private:
+    // -- Private Instance Variables
+    union {
+        integer64 signedValue;
+        uinteger64 unsignedValue;
+        double floatingPointValue;
+        const void* pointerValue;
+        const character* textValue;
+    };
+
+    // -- This is the size of the original integer type or the number of decimal places of a decimal.
+    count sizeOrPrecision = 0;
+
+    // -- Length of the text, when the argument is a text.
+    count lengthOfText = 0;
+
+    Kind kind = Kind::EndOfArguments;
+
+public:
+    // -- Constructors/Destructors
+    FormatArgument() : unsignedValue{ 0 } { }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+    FormatArgument(T value) : signedValue{ static_cast<integer64>(value) }, sizeOrPrecision{ sizeof(T) }, kind{ Kind::Signed } { }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+    FormatArgument(T value) : unsignedValue{ static_cast<uinteger64>(value) }, sizeOrPrecision{ sizeof(T) }, kind{ Kind::Unsigned } { }
+    template <typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    FormatArgument(T value) : FormatArgument{ static_cast<typename std::underlying_type<T>::type>(value) } { }
+    template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    FormatArgument(T value) : floatingPointValue{ static_cast<double>(value) }, kind{ Kind::FloatingPoint } { }
+    template <int precision>
+    FormatArgument(const dec::decimal<precision>& value)
+        : signedValue{ value.getUnbiased() }, sizeOrPrecision{ precision }, kind{ Kind::Decimal } { }
+    FormatArgument(const character* value) : textValue{ value }, kind{ Kind::Text }
+    {
+        NXA_ASSERT_NOT_NULL(value);
+        this->lengthOfText = ::strlen(value);
+    }
+    FormatArgument(const std::string& value) : textValue{ value.data() }, lengthOfText{ value.length() }, kind{ Kind::Text } { }
+    FormatArgument(const StringView& value) : textValue{ value.data() }, lengthOfText{ value.length() }, kind{ Kind::Text } { }
+    FormatArgument(const String&);
+    FormatArgument(const MutableString&);
+    FormatArgument(const void* value) : pointerValue{ value }, kind{ Kind::Pointer } { }
+    template <typename T>
+    FormatArgument(const Optional<T>& value) : FormatArgument{ }
+    {
+        if (value) {
+            *this = FormatArgument{ *value };
+        }
+        else {
+            this->kind = Kind::Nothing;
+        }
+    }
+
+    // -- Instance Methods
+    Kind argumentKind() const
+    {
+        return this->kind;
+    }
+    boolean isAnInteger() const
+    {
+        return (this->kind == Kind::Signed) || (this->kind == Kind::Unsigned);
+    }
+    boolean isANumber() const
+    {
+        return this->isAnInteger() || (this->kind == Kind::FloatingPoint) || (this->kind == Kind::Decimal);
+    }
+
+    integer64 asSignedInteger() const
+    {
+        return this->signedValue;
+    }
+    uinteger64 asUnsignedInteger() const
+    {
+        return this->unsignedValue;
+    }
+    double asFloatingPoint() const
+    {
+        return this->floatingPointValue;
+    }
+    const void* asPointer() const
+    {
+        return this->pointerValue;
+    }
+    const character* textCharacters() const
+    {
+        return this->textValue;
+    }
+    count textLength() const
+    {
+        return this->lengthOfText;
+    }
+    count integerSize() const
+    {
+        return this->sizeOrPrecision;
+    }
+    count decimalPrecision() const
+    {
+        return this->sizeOrPrecision;
+    }
+};
+
+// -- Formats printf-style format strings straight into the string receiving the result. Arguments are checked
+// -- against their conversion as they are used: any string type can be given to %s, numbers given to %s are written
+// -- in their natural form and an empty Optional is written as <nothing>. Giving a string to a numeric conversion or
+// -- too many or too few arguments for the format is an error.
+class StringFormatter
+{
+    // -- Private Class Methods
+    static void appendFormattedArgumentsTo(std::string&, const StringView&, const FormatArgument*);
+
+public:
+    // -- Class Methods
+    template <typename... FormatArguments>
+    static void appendFormattedTo(std::string& result, const StringView& format, const FormatArguments&... formatArguments)
+    {
+        // -- The extra empty argument marks the end of the list and avoids an empty array when there are no arguments.
+        const FormatArgument arguments[] = { FormatArgument{ formatArguments }..., FormatArgument{ } };
+        StringFormatter::appendFormattedArgumentsTo(result, format, arguments);
+    }
+};
+
+}
@@ -0,0 +1,177 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/StringView.hpp>
+#include <Base/Uncopyable.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NxA {
+
+// -- Joins the strings in an array, separated by another string. The strings can be anything with asUTF8() and
+// -- length() methods. The length of the result is always computed first so that it can be allocated only once.
+class StringJoiner : private Uncopyable
+{
+    // -- Private Constants
+    // -- Below this, starting threads costs more than the copies they would make.
+    static constexpr count minimumLengthCopiedPerThread = 1024 * 1024;
+
+public:
+    // -- Constructors & Destructors
+    StringJoiner() = delete;
+
+    // -- Class Methods
+    template <typename ArrayType>
+    static count lengthOfArrayJoinedWith(const ArrayType& array, const StringView& separator)
+    {
+        count result = 0;
+        count numberOfItems = 0;
+
+        for (auto&& item : array) {
+            result += item.length();
+            ++numberOfItems;
+        }
+
+        return (numberOfItems == 0) ? 0 : result + (separator.length() * (numberOfItems - 1));
+    }
+
+    // -- Calls the function with each piece of the joined string, in order, as a pointer to its characters and a length.
+    template <typename ArrayType, typename Function>
+    static void forEachPieceOfArrayJoinedWith(const ArrayType& array, const StringView& separator, Function&& function)
+    {
+        auto iterator = array.begin();
+        auto end = array.end();
+
+        while (iterator != end) {
+            function(iterator->asUTF8(), iterator->length());
+
+            if ((++iterator != end) && !separator.isEmpty()) {
+                function(separator.data(), separator.length());
+            }
+        }
+    }
+
+    template <typename ArrayType>
+    static std::string stdStringByJoiningArrayWith(const ArrayType& array, const StringView& separator)
+    {
+        std::string result;
+        result.reserve(StringJoiner::lengthOfArrayJoinedWith(array, separator));
+
+        StringJoiner::forEachPieceOfArrayJoinedWith(array, separator, [&result](const character* characters, count length) {
+            result.append(characters, length);
+        });
+
+        return result;
+    }
+
+    template <typename ArrayType>
+    static std::string stdStringByJoiningArrayInParallelWith(const ArrayType& array, const StringView& separator)
+    {
+        std::string result;
+        result.resize(StringJoiner::lengthOfArrayJoinedWith(array, separator));
+
+        StringJoiner::copyArrayJoinedWithInParallelTo(array, separator, &result[0], result.length());
+
+        return result;
+    }
+
+    // -- The destination must have room for lengthOfArrayJoinedWith() characters.
+    template <typename ArrayType>
+    static void copyArrayJoinedWithTo(const ArrayType& array, const StringView& separator, character* destination)
+    {
+        StringJoiner::forEachPieceOfArrayJoinedWith(array, separator, [&destination](const character* characters, count length) {
+            ::memcpy(destination, characters, length);
+            destination += length;
+        });
+    }
+
+    // -- Same as copyArrayJoinedWithTo() but splits the copies between threads when the result is large enough.
+    // -- The array needs random access iterators.
+    template <typename ArrayType>
+    static void copyArrayJoinedWithInParallelTo(const ArrayType& array, const StringView& separator, character* destination,
+                                                count totalLength)
+    {
+        auto first = array.begin();
+        count numberOfItems = array.end() - first;
+
+        count numberOfThreads = std::min<count>(std::max(std::thread::hardware_concurrency(), 1u),
+                                                totalLength / StringJoiner::minimumLengthCopiedPerThread);
+        numberOfThreads = std::min(numberOfThreads, numberOfItems);
+
+        if (numberOfThreads < 2) {
+            StringJoiner::copyArrayJoinedWithTo(array, separator, destination);
+            return;
+        }
+
+        // -- Each thread copies a range of items, so we first need to find where each range starts in the result.
+        count numberOfItemsPerThread = (numberOfItems + numberOfThreads - 1) / numberOfThreads;
+        std::vector<count> rangeOffsets;
+        rangeOffsets.reserve(numberOfThreads);
+
+        count offset = 0;
+        for (count index = 0; index < numberOfItems; ++index) {
+            if ((index % numberOfItemsPerThread) == 0) {
+                rangeOffsets.push_back(offset);
+            }
+
+            offset += first[index].length() + separator.length();
+        }
+
+        auto copyRange = [&](count rangeIndex) {
+            auto rangeStart = rangeIndex * numberOfItemsPerThread;
+            auto rangeEnd = std::min(rangeStart + numberOfItemsPerThread, numberOfItems);
+            auto rangeDestination = destination + rangeOffsets[rangeIndex];
+
+            for (auto index = rangeStart; index < rangeEnd; ++index) {
+                auto& item = first[index];
+                auto length = item.length();
+                ::memcpy(rangeDestination, item.asUTF8(), length);
+                rangeDestination += length;
+
+                if (index + 1 < numberOfItems) {
+                    ::memcpy(rangeDestination, separator.data(), separator.length());
+                    rangeDestination += separator.length();
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(rangeOffsets.size() - 1);
+        for (count rangeIndex = 1; rangeIndex < rangeOffsets.size(); ++rangeIndex) {
+            threads.emplace_back(copyRange, rangeIndex);
+        }
+
+        copyRange(0);
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+    }
+};
+
+}
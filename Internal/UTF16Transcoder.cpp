@@ -0,0 +1,367 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/Internal/UTF16Transcoder.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define NXA_UTF16_TRANSCODER_HAS_SSE2
+#endif
+
+using namespace NxA;
+
+// -- Constants
+
+static constexpr uinteger32 replacementCharacter = 0xfffd;
+
+// -- Number of characters converted at once when they are all ASCII.
+static constexpr count asciiBlockLength = 16;
+
+// -- Decoding and Encoding
+
+// -- Decodes the character at index and moves index past it. Invalid sequences are replaced by a single replacement
+// -- character, using as many bytes as were valid at the start of the sequence but always at least one.
+static inline uinteger32 decodeUTF8CharacterAt(const byte* text, count length, count& index)
+{
+    uinteger32 value = text[index++];
+    if (value < 0x80) {
+        return value;
+    }
+
+    count numberOfContinuationBytes;
+    byte minimumSecondByte = 0x80;
+    byte maximumSecondByte = 0xbf;
+    if (value < 0xc2) {
+        return replacementCharacter;
+    }
+    else if (value < 0xe0) {
+        numberOfContinuationBytes = 1;
+        value &= 0x1f;
+    }
+    else if (value < 0xf0) {
+        numberOfContinuationBytes = 2;
+        if (value == 0xe0) {
+            minimumSecondByte = 0xa0;
+        }
+        else if (value == 0xed) {
+            // -- UTF16 surrogates.
+            maximumSecondByte = 0x9f;
+        }
+
+        value &= 0x0f;
+    }
+    else if (value < 0xf5) {
+        numberOfContinuationBytes = 3;
+        if (value == 0xf0) {
+            minimumSecondByte = 0x90;
+        }
+        else if (value == 0xf4) {
+            // -- Anything above U+10FFFF.
+            maximumSecondByte = 0x8f;
+        }
+
+        value &= 0x07;
+    }
+    else {
+        return replacementCharacter;
+    }
+
+    for (count continuationIndex = 0; continuationIndex < numberOfContinuationBytes; ++continuationIndex) {
+        if (index >= length) {
+            return replacementCharacter;
+        }
+
+        byte nextByte = text[index];
+        if (continuationIndex == 0) {
+            if ((nextByte < minimumSecondByte) || (nextByte > maximumSecondByte)) {
+                return replacementCharacter;
+            }
+        }
+        else if ((nextByte & 0xc0) != 0x80) {
+            return replacementCharacter;
+        }
+
+        value = (value << 6) | (nextByte & 0x3f);
+        ++index;
+    }
+
+    return value;
+}
+
+// -- Decodes the big-endian character at index and moves index past it. Size must be even.
+static inline uinteger32 decodeUTF16CharacterAt(const byte* text, count size, count& index)
+{
+    uinteger32 value = (static_cast<uinteger32>(text[index]) << 8) | text[index + 1];
+    index += 2;
+
+    if ((value < 0xd800) || (value > 0xdfff)) {
+        return value;
+    }
+
+    if ((value > 0xdbff) || (index == size)) {
+        return replacementCharacter;
+    }
+
+    uinteger32 lowSurrogate = (static_cast<uinteger32>(text[index]) << 8) | text[index + 1];
+    if ((lowSurrogate < 0xdc00) || (lowSurrogate > 0xdfff)) {
+        return replacementCharacter;
+    }
+
+    index += 2;
+
+    return 0x10000 + ((value - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+}
+
+static inline count sizeOfUTF16ForCharacter(uinteger32 value)
+{
+    return (value < 0x10000) ? 2 : 4;
+}
+
+static inline count lengthOfUTF8ForCharacter(uinteger32 value)
+{
+    if (value < 0x80) {
+        return 1;
+    }
+    else if (value < 0x800) {
+        return 2;
+    }
+    else if (value < 0x10000) {
+        return 3;
+    }
+
+    return 4;
+}
+
+static inline byte* encodeUTF16CharacterTo(uinteger32 value, byte* destination)
+{
+    if (value >= 0x10000) {
+        value -= 0x10000;
+        uinteger32 highSurrogate = 0xd800 + (value >> 10);
+        destination[0] = static_cast<byte>(highSurrogate >> 8);
+        destination[1] = static_cast<byte>(highSurrogate);
+        destination += 2;
+
+        value = 0xdc00 + (value & 0x3ff);
+    }
+
+    destination[0] = static_cast<byte>(value >> 8);
+    destination[1] = static_cast<byte>(value);
+
+    return destination + 2;
+}
+
+static inline byte* encodeUTF8CharacterTo(uinteger32 value, byte* destination)
+{
+    if (value < 0x80) {
+        *destination = static_cast<byte>(value);
+        return destination + 1;
+    }
+    else if (value < 0x800) {
+        destination[0] = static_cast<byte>(0xc0 | (value >> 6));
+        destination[1] = static_cast<byte>(0x80 | (value & 0x3f));
+        return destination + 2;
+    }
+    else if (value < 0x10000) {
+        destination[0] = static_cast<byte>(0xe0 | (value >> 12));
+        destination[1] = static_cast<byte>(0x80 | ((value >> 6) & 0x3f));
+        destination[2] = static_cast<byte>(0x80 | (value & 0x3f));
+        return destination + 3;
+    }
+
+    destination[0] = static_cast<byte>(0xf0 | (value >> 18));
+    destination[1] = static_cast<byte>(0x80 | ((value >> 12) & 0x3f));
+    destination[2] = static_cast<byte>(0x80 | ((value >> 6) & 0x3f));
+    destination[3] = static_cast<byte>(0x80 | (value & 0x3f));
+    return destination + 4;
+}
+
+#if defined(NXA_UTF16_TRANSCODER_HAS_SSE2)
+
+// -- SSE2 Implementation
+
+static inline boolean isASCIIBlockInUTF8At(const byte* text)
+{
+    return !_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text)));
+}
+
+static inline boolean isASCIIBlockInUTF16At(const byte* text)
+{
+    // -- Loaded as little-endian words, big-endian ASCII characters only have bits set in 0x7f00.
+    auto mask = _mm_set1_epi16(static_cast<short>(0x80ff));
+    auto first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+    auto second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 16));
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(_mm_or_si128(first, second), mask), _mm_setzero_si128())) == 0xffff;
+}
+
+static inline boolean copyUTF16FromASCIIBlockInUTF8At(const byte* source, byte* destination)
+{
+    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    if (_mm_movemask_epi8(bytes)) {
+        return false;
+    }
+
+    // -- Interleaving zeros before each byte gives big-endian characters.
+    auto zeros = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi8(zeros, bytes));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 16), _mm_unpackhi_epi8(zeros, bytes));
+
+    return true;
+}
+
+static inline boolean copyUTF8FromASCIIBlockInUTF16At(const byte* source, byte* destination)
+{
+    if (!isASCIIBlockInUTF16At(source)) {
+        return false;
+    }
+
+    auto first = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)), 8);
+    auto second = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16)), 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_packus_epi16(first, second));
+
+    return true;
+}
+
+#else
+
+// -- Portable Implementation
+
+static inline uinteger64 readUInteger64At(const byte* pointer)
+{
+    uinteger64 value;
+    ::memcpy(&value, pointer, sizeof(value));
+    return value;
+}
+
+static inline boolean isASCIIBlockInUTF8At(const byte* text)
+{
+    return !((readUInteger64At(text) | readUInteger64At(text + 8)) & 0x8080808080808080ULL);
+}
+
+static inline boolean isASCIIBlockInUTF16At(const byte* text)
+{
+    for (count index = 0; index < (asciiBlockLength * 2); index += 2) {
+        if (text[index] || (text[index + 1] & 0x80)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static inline boolean copyUTF16FromASCIIBlockInUTF8At(const byte* source, byte* destination)
+{
+    if (!isASCIIBlockInUTF8At(source)) {
+        return false;
+    }
+
+    for (count index = 0; index < asciiBlockLength; ++index) {
+        destination[index * 2] = 0;
+        destination[(index * 2) + 1] = source[index];
+    }
+
+    return true;
+}
+
+static inline boolean copyUTF8FromASCIIBlockInUTF16At(const byte* source, byte* destination)
+{
+    if (!isASCIIBlockInUTF16At(source)) {
+        return false;
+    }
+
+    for (count index = 0; index < asciiBlockLength; ++index) {
+        destination[index] = source[(index * 2) + 1];
+    }
+
+    return true;
+}
+
+#endif
+
+// -- Class Methods
+
+count UTF16Transcoder::sizeOfUTF16ForUTF8(const byte* text, count length)
+{
+    count result = 0;
+    count index = 0;
+    while (index < length) {
+        if (((index + asciiBlockLength) <= length) && isASCIIBlockInUTF8At(text + index)) {
+            index += asciiBlockLength;
+            result += asciiBlockLength * 2;
+            continue;
+        }
+
+        result += sizeOfUTF16ForCharacter(decodeUTF8CharacterAt(text, length, index));
+    }
+
+    return result;
+}
+
+void UTF16Transcoder::copyUTF16FromUTF8AndSizeTo(const byte* text, count length, byte* destination)
+{
+    count index = 0;
+    while (index < length) {
+        if (((index + asciiBlockLength) <= length) && copyUTF16FromASCIIBlockInUTF8At(text + index, destination)) {
+            index += asciiBlockLength;
+            destination += asciiBlockLength * 2;
+            continue;
+        }
+
+        destination = encodeUTF16CharacterTo(decodeUTF8CharacterAt(text, length, index), destination);
+    }
+}
+
+count UTF16Transcoder::lengthOfUTF8ForUTF16(const byte* text, count size)
+{
+    size &= ~static_cast<count>(1);
+
+    count result = 0;
+    count index = 0;
+    while (index < size) {
+        if (((index + (asciiBlockLength * 2)) <= size) && isASCIIBlockInUTF16At(text + index)) {
+            index += asciiBlockLength * 2;
+            result += asciiBlockLength;
+            continue;
+        }
+
+        result += lengthOfUTF8ForCharacter(decodeUTF16CharacterAt(text, size, index));
+    }
+
+    return result;
+}
+
+void UTF16Transcoder::copyUTF8FromUTF16AndSizeTo(const byte* text, count size, byte* destination)
+{
+    size &= ~static_cast<count>(1);
+
+    count index = 0;
+    while (index < size) {
+        if (((index + (asciiBlockLength * 2)) <= size) && copyUTF8FromASCIIBlockInUTF16At(text + index, destination)) {
+            index += asciiBlockLength * 2;
+            destination += asciiBlockLength;
+            continue;
+        }
+
+        destination = encodeUTF8CharacterTo(decodeUTF16CharacterAt(text, size, index), destination);
+    }
+}
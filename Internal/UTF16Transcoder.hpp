@@ -0,0 +1,47 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Uncopyable.hpp>
+
+namespace NxA {
+
+// -- Converts between UTF8 and big-endian UTF16 in two passes: one to compute the exact size of the result, so that
+// -- it can be allocated only once, and one to convert into it. Runs of ASCII characters are converted 16 at a time.
+// -- Invalid UTF8 sequences and unpaired surrogates are converted to the replacement character U+FFFD.
+class UTF16Transcoder : private Uncopyable
+{
+public:
+    // -- Constructors & Destructors
+    UTF16Transcoder() = delete;
+
+    // -- Class Methods
+    static count sizeOfUTF16ForUTF8(const byte*, count);
+    static void copyUTF16FromUTF8AndSizeTo(const byte*, count, byte*);
+
+    // -- The size of the UTF16 text is in bytes, an odd last byte is ignored.
+    static count lengthOfUTF8ForUTF16(const byte*, count);
+    static void copyUTF8FromUTF16AndSizeTo(const byte*, count, byte*);
+};
+
+}
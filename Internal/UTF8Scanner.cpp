@@ -0,0 +1,640 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/Internal/UTF8Scanner.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define NXA_UTF8_SCANNER_HAS_SSE2
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__GNUC__)
+#include <immintrin.h>
+#define NXA_UTF8_SCANNER_HAS_AVX2
+#define NXA_UTF8_SCANNER_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+#endif
+
+using namespace NxA;
+
+// -- Portable Implementation
+
+static inline uinteger64 readUInteger64At(const byte* pointer)
+{
+    uinteger64 value;
+    ::memcpy(&value, pointer, sizeof(value));
+    return value;
+}
+
+// -- Returns a non-zero value if any of the 8 bytes in the word is a non-printable character.
+static inline uinteger64 nonPrintableBytesInWord(uinteger64 word)
+{
+    constexpr uinteger64 ones = 0x0101010101010101ULL;
+    constexpr uinteger64 highBits = 0x8080808080808080ULL;
+
+    // -- Only bytes below 0x80 can be non-printable, their high bit is cleared so additions can't carry over.
+    auto ascii = ~word & highBits;
+    auto lowBits = word & ~highBits;
+
+    auto isBelow0x20 = ~(lowBits + (ones * (0x80 - 0x20))) & highBits;
+    auto is0x7f = (lowBits + ones) & highBits;
+    auto isTab = ~((lowBits ^ (ones * 0x09)) + (ones * 0x7f)) & highBits;
+    auto isLineFeed = ~((lowBits ^ (ones * 0x0a)) + (ones * 0x7f)) & highBits;
+    auto isCarriageReturn = ~((lowBits ^ (ones * 0x0d)) + (ones * 0x7f)) & highBits;
+
+    return ((isBelow0x20 & ~(isTab | isLineFeed | isCarriageReturn)) | is0x7f) & ascii;
+}
+
+// -- Flips the case of the bytes in the word which are between first and last.
+template <byte first, byte last>
+static inline uinteger64 wordWithCaseOfLettersChanged(uinteger64 word)
+{
+    constexpr uinteger64 ones = 0x0101010101010101ULL;
+    constexpr uinteger64 highBits = 0x8080808080808080ULL;
+
+    auto lowBits = word & ~highBits;
+    auto isAtLeastFirst = (lowBits + (ones * (0x80 - first))) & highBits;
+    auto isAboveLast = (lowBits + (ones * (0x80 - last - 1))) & highBits;
+    auto isLetter = isAtLeastFirst & ~isAboveLast & ~word;
+
+    // -- Upper and lower case ASCII letters only differ by their 0x20 bit.
+    return word ^ (isLetter >> 2);
+}
+
+static boolean isValidUTF8Portable(const byte* text, count length)
+{
+    count index = 0;
+    while (index < length) {
+        if (((index + 8) <= length) && !(readUInteger64At(text + index) & 0x8080808080808080ULL)) {
+            index += 8;
+            continue;
+        }
+
+        byte value = text[index];
+        if (value < 0x80) {
+            ++index;
+            continue;
+        }
+
+        count numberOfContinuationBytes;
+        byte minimumSecondByte = 0x80;
+        byte maximumSecondByte = 0xbf;
+        if (value < 0xc2) {
+            // -- Continuation bytes can't start a sequence, 0xc0 and 0xc1 would only encode overlong ASCII characters.
+            return false;
+        }
+        else if (value < 0xe0) {
+            numberOfContinuationBytes = 1;
+        }
+        else if (value < 0xf0) {
+            numberOfContinuationBytes = 2;
+            if (value == 0xe0) {
+                minimumSecondByte = 0xa0;
+            }
+            else if (value == 0xed) {
+                // -- UTF16 surrogates.
+                maximumSecondByte = 0x9f;
+            }
+        }
+        else if (value < 0xf5) {
+            numberOfContinuationBytes = 3;
+            if (value == 0xf0) {
+                minimumSecondByte = 0x90;
+            }
+            else if (value == 0xf4) {
+                // -- Anything above U+10FFFF.
+                maximumSecondByte = 0x8f;
+            }
+        }
+        else {
+            return false;
+        }
+
+        if ((index + numberOfContinuationBytes) >= length) {
+            return false;
+        }
+
+        byte secondByte = text[index + 1];
+        if ((secondByte < minimumSecondByte) || (secondByte > maximumSecondByte)) {
+            return false;
+        }
+
+        for (count continuationIndex = 2; continuationIndex <= numberOfContinuationBytes; ++continuationIndex) {
+            if ((text[index + continuationIndex] & 0xc0) != 0x80) {
+                return false;
+            }
+        }
+
+        index += numberOfContinuationBytes + 1;
+    }
+
+    return true;
+}
+
+static count indexOfFirstNonPrintableCharacterPortable(const byte* text, count length, count index = 0)
+{
+    for (; (index + 8) <= length; index += 8) {
+        if (nonPrintableBytesInWord(readUInteger64At(text + index))) {
+            break;
+        }
+    }
+
+    for (; index < length; ++index) {
+        if (UTF8Scanner::isNonPrintableCharacter(text[index])) {
+            return index;
+        }
+    }
+
+    return length;
+}
+
+static count copyPrintableCharactersPortable(const byte* source, count length, byte* destination, count index = 0, count copied = 0)
+{
+    for (; (index + 8) <= length; index += 8) {
+        auto word = readUInteger64At(source + index);
+        if (!nonPrintableBytesInWord(word)) {
+            ::memcpy(destination + copied, &word, sizeof(word));
+            copied += 8;
+            continue;
+        }
+
+        for (count wordIndex = index; wordIndex < (index + 8); ++wordIndex) {
+            if (!UTF8Scanner::isNonPrintableCharacter(source[wordIndex])) {
+                destination[copied++] = source[wordIndex];
+            }
+        }
+    }
+
+    for (; index < length; ++index) {
+        if (!UTF8Scanner::isNonPrintableCharacter(source[index])) {
+            destination[copied++] = source[index];
+        }
+    }
+
+    return copied;
+}
+
+static count indexOfFirstNonASCIICharacterPortable(const byte* text, count length, count index = 0)
+{
+    for (; (index + 8) <= length; index += 8) {
+        if (readUInteger64At(text + index) & 0x8080808080808080ULL) {
+            break;
+        }
+    }
+
+    for (; index < length; ++index) {
+        if (text[index] & 0x80) {
+            return index;
+        }
+    }
+
+    return length;
+}
+
+template <byte first, byte last>
+static void copyWithCaseOfLettersChangedPortable(const byte* source, count length, byte* destination, count index = 0)
+{
+    for (; (index + 8) <= length; index += 8) {
+        auto word = wordWithCaseOfLettersChanged<first, last>(readUInteger64At(source + index));
+        ::memcpy(destination + index, &word, sizeof(word));
+    }
+
+    for (; index < length; ++index) {
+        auto value = source[index];
+        destination[index] = ((value >= first) && (value <= last)) ? (value ^ 0x20) : value;
+    }
+}
+
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+
+// -- SSE2 Implementation
+
+// -- Index of the lowest bit set in a non-zero mask.
+static inline count indexOfLowestBitSetIn(uinteger32 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+static inline uinteger32 nonPrintableBytesMaskSSE2(__m128i bytes)
+{
+    auto isBelow0x20 = _mm_cmpeq_epi8(_mm_max_epu8(bytes, _mm_set1_epi8(0x1f)), _mm_set1_epi8(0x1f));
+    auto isAllowedControl = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x09)), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x0a))),
+                                         _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x0d)));
+    auto is0x7f = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x7f));
+
+    return static_cast<uinteger32>(_mm_movemask_epi8(_mm_or_si128(_mm_andnot_si128(isAllowedControl, isBelow0x20), is0x7f)));
+}
+
+static boolean isValidUTF8SSE2(const byte* text, count length)
+{
+    // -- SSE2 can't do table lookups so only runs of ASCII characters are skipped 16 bytes at a time. Non-ASCII
+    // -- sequences are checked by the portable code, starting from the last character that could begin one.
+    count index = 0;
+    while ((index + 16) <= length) {
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index));
+        if (!_mm_movemask_epi8(bytes)) {
+            index += 16;
+            continue;
+        }
+
+        count end = index + 16;
+        while ((end < length) && ((text[end] & 0xc0) == 0x80)) {
+            ++end;
+        }
+
+        if (!isValidUTF8Portable(text + index, end - index)) {
+            return false;
+        }
+
+        index = end;
+    }
+
+    return isValidUTF8Portable(text + index, length - index);
+}
+
+static count indexOfFirstNonPrintableCharacterSSE2(const byte* text, count length)
+{
+    count index = 0;
+    for (; (index + 16) <= length; index += 16) {
+        auto mask = nonPrintableBytesMaskSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index)));
+        if (mask) {
+            return index + indexOfLowestBitSetIn(mask);
+        }
+    }
+
+    return indexOfFirstNonPrintableCharacterPortable(text, length, index);
+}
+
+static count copyPrintableCharactersSSE2(const byte* source, count length, byte* destination)
+{
+    count index = 0;
+    count copied = 0;
+    for (; (index + 16) <= length; index += 16) {
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        auto mask = nonPrintableBytesMaskSSE2(bytes);
+        if (!mask) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + copied), bytes);
+            copied += 16;
+            continue;
+        }
+
+        for (count blockIndex = 0; blockIndex < 16; ++blockIndex) {
+            if (!(mask & (1u << blockIndex))) {
+                destination[copied++] = source[index + blockIndex];
+            }
+        }
+    }
+
+    return copyPrintableCharactersPortable(source, length, destination, index, copied);
+}
+
+static count indexOfFirstNonASCIICharacterSSE2(const byte* text, count length)
+{
+    count index = 0;
+    for (; (index + 16) <= length; index += 16) {
+        auto mask = static_cast<uinteger32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index))));
+        if (mask) {
+            return index + indexOfLowestBitSetIn(mask);
+        }
+    }
+
+    return indexOfFirstNonASCIICharacterPortable(text, length, index);
+}
+
+template <byte first, byte last>
+static void copyWithCaseOfLettersChangedSSE2(const byte* source, count length, byte* destination)
+{
+    count index = 0;
+    for (; (index + 16) <= length; index += 16) {
+        // -- Bytes above 0x7f are negative when compared as signed values so they are never in the range.
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(bytes, _mm_set1_epi8(last + 1)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), _mm_xor_si128(bytes, _mm_and_si128(isLetter, _mm_set1_epi8(0x20))));
+    }
+
+    copyWithCaseOfLettersChangedPortable<first, last>(source, length, destination, index);
+}
+
+#endif
+
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+
+// -- AVX2 Implementation
+
+// -- UTF8 validation using the lookup algorithm from "Validating UTF-8 In Less Than One Instruction Per Byte"
+// -- by John Keiser and Daniel Lemire. Each pair of consecutive bytes is classified with three table lookups
+// -- whose results share a bit only when the pair is invalid.
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static inline __m256i previousBytesAVX2(__m256i bytes, __m256i previousBytes, integer32 distance)
+{
+    auto shiftedIn = _mm256_permute2x128_si256(previousBytes, bytes, 0x21);
+    switch (distance) {
+        case 1: {
+            return _mm256_alignr_epi8(bytes, shiftedIn, 16 - 1);
+        }
+        case 2: {
+            return _mm256_alignr_epi8(bytes, shiftedIn, 16 - 2);
+        }
+        default: {
+            return _mm256_alignr_epi8(bytes, shiftedIn, 16 - 3);
+        }
+    }
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static inline __m256i highNibblesAVX2(__m256i bytes)
+{
+    return _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0f));
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static inline __m256i utf8ErrorsInBytesAVX2(__m256i bytes, __m256i previousBytes)
+{
+    constexpr byte tooShort = 1 << 0;
+    constexpr byte tooLong = 1 << 1;
+    constexpr byte overlong3 = 1 << 2;
+    constexpr byte tooLarge = 1 << 3;
+    constexpr byte surrogate = 1 << 4;
+    constexpr byte overlong2 = 1 << 5;
+    constexpr byte tooLarge1000 = 1 << 6;
+    constexpr byte overlong4 = 1 << 6;
+    constexpr byte twoContinuations = 1 << 7;
+    constexpr byte carry = tooShort | tooLong | twoContinuations;
+
+    auto previous1 = previousBytesAVX2(bytes, previousBytes, 1);
+
+    auto firstByteHighTable = _mm256_setr_epi8(
+        tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, twoContinuations, twoContinuations, twoContinuations,
+        twoContinuations, tooShort | overlong2, tooShort, tooShort | overlong3 | surrogate, tooShort | tooLarge | tooLarge1000 | overlong4,
+        tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, twoContinuations, twoContinuations, twoContinuations,
+        twoContinuations, tooShort | overlong2, tooShort, tooShort | overlong3 | surrogate, tooShort | tooLarge | tooLarge1000 | overlong4);
+    auto firstByteLowTable = _mm256_setr_epi8(
+        carry | overlong3 | overlong2 | overlong4, carry | overlong2, carry, carry, carry | tooLarge, carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000 | surrogate, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+        carry | overlong3 | overlong2 | overlong4, carry | overlong2, carry, carry, carry | tooLarge, carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+        carry | tooLarge | tooLarge1000 | surrogate, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000);
+    auto secondByteHighTable = _mm256_setr_epi8(
+        tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+        tooLong | overlong2 | twoContinuations | overlong3 | tooLarge1000 | overlong4, tooLong | overlong2 | twoContinuations | overlong3 | tooLarge,
+        tooLong | overlong2 | twoContinuations | surrogate | tooLarge, tooLong | overlong2 | twoContinuations | surrogate | tooLarge, tooShort,
+        tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+        tooLong | overlong2 | twoContinuations | overlong3 | tooLarge1000 | overlong4, tooLong | overlong2 | twoContinuations | overlong3 | tooLarge,
+        tooLong | overlong2 | twoContinuations | surrogate | tooLarge, tooLong | overlong2 | twoContinuations | surrogate | tooLarge, tooShort,
+        tooShort, tooShort, tooShort);
+
+    auto specialCases = _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(firstByteHighTable, highNibblesAVX2(previous1)),
+                                                           _mm256_shuffle_epi8(firstByteLowTable, _mm256_and_si256(previous1, _mm256_set1_epi8(0x0f)))),
+                                         _mm256_shuffle_epi8(secondByteHighTable, highNibblesAVX2(bytes)));
+
+    // -- The third and fourth bytes of a sequence must be continuations, which the lookups above can't see.
+    auto isThirdByte = _mm256_subs_epu8(previousBytesAVX2(bytes, previousBytes, 2), _mm256_set1_epi8(static_cast<character>(0xe0 - 0x80)));
+    auto isFourthByte = _mm256_subs_epu8(previousBytesAVX2(bytes, previousBytes, 3), _mm256_set1_epi8(static_cast<character>(0xf0 - 0x80)));
+    auto mustBeContinuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8(static_cast<character>(0x80)));
+
+    return _mm256_xor_si256(mustBeContinuation, specialCases);
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static inline __m256i incompleteSequenceAtTheEndOfAVX2(__m256i bytes)
+{
+    // -- Only the last three bytes can start a sequence that continues in the next block.
+    auto maximumValues = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                          -1, -1, -1, static_cast<character>(0xf0 - 1), static_cast<character>(0xe0 - 1),
+                                          static_cast<character>(0xc0 - 1));
+    return _mm256_subs_epu8(bytes, maximumValues);
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static inline void checkUTF8BlockAVX2(__m256i bytes, __m256i& errors, __m256i& previousBytes,
+                                                                     __m256i& previousIncomplete)
+{
+    if (!_mm256_movemask_epi8(bytes)) {
+        // -- An ASCII block is only invalid if the previous one ended in the middle of a sequence.
+        errors = _mm256_or_si256(errors, previousIncomplete);
+        previousIncomplete = _mm256_setzero_si256();
+    }
+    else {
+        errors = _mm256_or_si256(errors, utf8ErrorsInBytesAVX2(bytes, previousBytes));
+        previousIncomplete = incompleteSequenceAtTheEndOfAVX2(bytes);
+    }
+
+    previousBytes = bytes;
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static boolean isValidUTF8AVX2(const byte* text, count length)
+{
+    auto errors = _mm256_setzero_si256();
+    auto previousBytes = _mm256_setzero_si256();
+    auto previousIncomplete = _mm256_setzero_si256();
+
+    count index = 0;
+    for (; (index + 32) <= length; index += 32) {
+        checkUTF8BlockAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + index)), errors, previousBytes, previousIncomplete);
+    }
+
+    if (index < length) {
+        alignas(32) byte lastBlock[32] = { };
+        ::memcpy(lastBlock, text + index, length - index);
+        checkUTF8BlockAVX2(_mm256_load_si256(reinterpret_cast<const __m256i*>(lastBlock)), errors, previousBytes, previousIncomplete);
+    }
+
+    errors = _mm256_or_si256(errors, previousIncomplete);
+    return _mm256_testz_si256(errors, errors);
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static inline uinteger32 nonPrintableBytesMaskAVX2(__m256i bytes)
+{
+    auto isBelow0x20 = _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, _mm256_set1_epi8(0x1f)), _mm256_set1_epi8(0x1f));
+    auto isAllowedControl = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(0x09)),
+                                                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(0x0a))),
+                                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(0x0d)));
+    auto is0x7f = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(0x7f));
+
+    return static_cast<uinteger32>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_andnot_si256(isAllowedControl, isBelow0x20), is0x7f)));
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static count indexOfFirstNonPrintableCharacterAVX2(const byte* text, count length)
+{
+    count index = 0;
+    for (; (index + 32) <= length; index += 32) {
+        auto mask = nonPrintableBytesMaskAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + index)));
+        if (mask) {
+            return index + indexOfLowestBitSetIn(mask);
+        }
+    }
+
+    return indexOfFirstNonPrintableCharacterPortable(text, length, index);
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static count copyPrintableCharactersAVX2(const byte* source, count length, byte* destination)
+{
+    count index = 0;
+    count copied = 0;
+    for (; (index + 32) <= length; index += 32) {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+        auto mask = nonPrintableBytesMaskAVX2(bytes);
+        if (!mask) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + copied), bytes);
+            copied += 32;
+            continue;
+        }
+
+        for (count blockIndex = 0; blockIndex < 32; ++blockIndex) {
+            if (!(mask & (1u << blockIndex))) {
+                destination[copied++] = source[index + blockIndex];
+            }
+        }
+    }
+
+    return copyPrintableCharactersPortable(source, length, destination, index, copied);
+}
+
+NXA_UTF8_SCANNER_AVX2_FUNCTION static count indexOfFirstNonASCIICharacterAVX2(const byte* text, count length)
+{
+    count index = 0;
+    for (; (index + 32) <= length; index += 32) {
+        auto mask = static_cast<uinteger32>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + index))));
+        if (mask) {
+            return index + indexOfLowestBitSetIn(mask);
+        }
+    }
+
+    return indexOfFirstNonASCIICharacterPortable(text, length, index);
+}
+
+template <byte first, byte last>
+NXA_UTF8_SCANNER_AVX2_FUNCTION static void copyWithCaseOfLettersChangedAVX2(const byte* source, count length, byte* destination)
+{
+    count index = 0;
+    for (; (index + 32) <= length; index += 32) {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+        auto isLetter = _mm256_andnot_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(last)), _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(first - 1)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index),
+                            _mm256_xor_si256(bytes, _mm256_and_si256(isLetter, _mm256_set1_epi8(0x20))));
+    }
+
+    copyWithCaseOfLettersChangedPortable<first, last>(source, length, destination, index);
+}
+
+static boolean processorSupportsAVX2()
+{
+    static const boolean supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif
+
+// -- Class Methods
+
+boolean UTF8Scanner::isValidUTF8(const byte* text, count length)
+{
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        return isValidUTF8AVX2(text, length);
+    }
+#endif
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+    return isValidUTF8SSE2(text, length);
+#else
+    return isValidUTF8Portable(text, length);
+#endif
+}
+
+count UTF8Scanner::indexOfFirstNonPrintableCharacterIn(const byte* text, count length)
+{
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        return indexOfFirstNonPrintableCharacterAVX2(text, length);
+    }
+#endif
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+    return indexOfFirstNonPrintableCharacterSSE2(text, length);
+#else
+    return indexOfFirstNonPrintableCharacterPortable(text, length);
+#endif
+}
+
+count UTF8Scanner::copyPrintableCharactersFromAndSizeTo(const byte* source, count length, byte* destination)
+{
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        return copyPrintableCharactersAVX2(source, length, destination);
+    }
+#endif
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+    return copyPrintableCharactersSSE2(source, length, destination);
+#else
+    return copyPrintableCharactersPortable(source, length, destination);
+#endif
+}
+
+count UTF8Scanner::indexOfFirstNonASCIICharacterIn(const byte* text, count length)
+{
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        return indexOfFirstNonASCIICharacterAVX2(text, length);
+    }
+#endif
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+    return indexOfFirstNonASCIICharacterSSE2(text, length);
+#else
+    return indexOfFirstNonASCIICharacterPortable(text, length);
+#endif
+}
+
+void UTF8Scanner::copyWithLowerCaseASCIICharactersFromAndSizeTo(const byte* source, count length, byte* destination)
+{
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        copyWithCaseOfLettersChangedAVX2<'A', 'Z'>(source, length, destination);
+        return;
+    }
+#endif
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+    copyWithCaseOfLettersChangedSSE2<'A', 'Z'>(source, length, destination);
+#else
+    copyWithCaseOfLettersChangedPortable<'A', 'Z'>(source, length, destination);
+#endif
+}
+
+void UTF8Scanner::copyWithUpperCaseASCIICharactersFromAndSizeTo(const byte* source, count length, byte* destination)
+{
+#if defined(NXA_UTF8_SCANNER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        copyWithCaseOfLettersChangedAVX2<'a', 'z'>(source, length, destination);
+        return;
+    }
+#endif
+#if defined(NXA_UTF8_SCANNER_HAS_SSE2)
+    copyWithCaseOfLettersChangedSSE2<'a', 'z'>(source, length, destination);
+#else
+    copyWithCaseOfLettersChangedPortable<'a', 'z'>(source, length, destination);
+#endif
+}
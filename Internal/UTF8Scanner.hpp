@@ -0,0 +1,60 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Uncopyable.hpp>
+
+namespace NxA {
+
+// -- Bulk scanning of UTF8 text. Each method picks, the first time it is called, the fastest implementation the
+// -- processor supports: AVX2, SSE2 or a portable one working on 8 bytes at a time.
+class UTF8Scanner : private Uncopyable
+{
+public:
+    // -- Constructors & Destructors
+    UTF8Scanner() = delete;
+
+    // -- Class Methods
+    // -- Non-printable characters are the ASCII control characters, except for tabs, line feeds and carriage returns.
+    static boolean isNonPrintableCharacter(byte value)
+    {
+        return ((value <= 0x1f) && (value != 0x09) && (value != 0x0a) && (value != 0x0d)) || (value == 0x7f);
+    }
+
+    static boolean isValidUTF8(const byte*, count);
+
+    // -- Returns the length of the text if it doesn't contain any non-printable characters.
+    static count indexOfFirstNonPrintableCharacterIn(const byte*, count);
+
+    // -- The destination must be able to hold as many bytes as the source, returns the number of bytes copied.
+    static count copyPrintableCharactersFromAndSizeTo(const byte*, count, byte*);
+
+    // -- Returns the length of the text if it only contains ASCII characters.
+    static count indexOfFirstNonASCIICharacterIn(const byte*, count);
+
+    // -- Only the ASCII letters are converted, any other bytes are copied as is. The source and destination can be the same.
+    static void copyWithLowerCaseASCIICharactersFromAndSizeTo(const byte*, count, byte*);
+    static void copyWithUpperCaseASCIICharactersFromAndSizeTo(const byte*, count, byte*);
+};
+
+}
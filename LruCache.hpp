@@ -22,122 +22,888 @@
 #pragma once
 
 #include <Base/Types.hpp>
+#include <Base/Assert.hpp>
+#include <Base/Optional.hpp>
 
-#include <map>
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace NxA {
 
-template <typename K, typename V>
-class LruCache : public std::list<std::pair<K, V>>
+// -- Template used to detect types which provide their own integral hash() method (like String).
+template <typename T>
+class HasHashMember
 {
-    using List = std::list<std::pair<K, V>>;
-    std::map<K, typename List::iterator> map = {};
-    size_t limit = 0;
+    template <typename U>
+    static constexpr auto test(int) -> decltype(std::enable_if_t<std::is_integral<decltype(std::declval<const U>().hash())>::value>(),
+                                                std::true_type{});
+
+    template <typename>
+    static constexpr std::false_type test(...);
 
 public:
-#ifdef LUR_TRACK_HITS
-    int hits = 0, misses = 0;
-#endif
+    using type = decltype(test<T>(0));
+    static constexpr bool value = type::value;
+};
 
-    using key_type = K;
-    using value_type = V;
+// -- Template used to hash keys stored in a cache. Types with a hash() method use it, everything else uses std::hash.
+template <typename T, typename Enable = void>
+struct CacheKeyHasher
+{
+    static uinteger64 hashFor(const T& key)
+    {
+        return std::hash<T>{}(key);
+    }
+};
+
+template <typename T>
+struct CacheKeyHasher<T, std::enable_if_t<HasHashMember<T>::value>>
+{
+    static uinteger64 hashFor(const T& key)
+    {
+        return key.hash();
+    }
+};
+
+// -- Snapshot of the statistics gathered by a cache.
+struct LruCacheStatistics
+{
+    count numberOfHits = 0;
+    count numberOfMisses = 0;
+    count numberOfInsertions = 0;
+    count numberOfEvictions = 0;
+    count numberOfRejections = 0;
+    count totalEvictedCost = 0;
+    count numberOfEntries = 0;
+    count totalCost = 0;
+
+    // -- Operators
+    LruCacheStatistics& operator+=(const LruCacheStatistics& other)
+    {
+        this->numberOfHits += other.numberOfHits;
+        this->numberOfMisses += other.numberOfMisses;
+        this->numberOfInsertions += other.numberOfInsertions;
+        this->numberOfEvictions += other.numberOfEvictions;
+        this->numberOfRejections += other.numberOfRejections;
+        this->totalEvictedCost += other.totalEvictedCost;
+        this->numberOfEntries += other.numberOfEntries;
+        this->totalCost += other.totalCost;
+
+        return *this;
+    }
+
+    // -- Instance Methods
+    double hitRate() const
+    {
+        auto numberOfLookups = this->numberOfHits + this->numberOfMisses;
+        return numberOfLookups ? double(this->numberOfHits) / double(numberOfLookups) : 0.0;
+    }
+};
+
+// -- Default policy for LruCache, every new entry is admitted and the least recently used entry is evicted.
+struct LruEvictionPolicy
+{
+    // -- Instance Methods
+    void resizeForNumberOfEntries(count)
+    {
+    }
+
+    void recordAccessForHash(uinteger64)
+    {
+    }
+
+    boolean shouldAdmitCandidateWithHashOverVictimWithHash(uinteger64, uinteger64) const
+    {
+        return true;
+    }
+};
+
+// -- TinyLFU admission policy. Access frequencies are estimated with a count-min sketch of 4-bit counters which
+// -- are halved periodically so that old popularity fades. Once the cache is full, a new entry is only admitted if
+// -- it was accessed more often than the entry it would evict, so a single pass over many keys can't flush the
+// -- frequently used ones.
+class TinyLfuAdmissionPolicy
+{
+    // -- Constants
+    static constexpr count numberOfRows = 4;
+    static constexpr count countersPerWord = 16;
+    static constexpr uinteger64 maximumCounterValue = 15;
+    static constexpr count maximumNumberOfTrackedEntries = count(1) << 24;
+
+    // -- Private Instance Variables
+    std::vector<uinteger64> counters;
+    count counterMask = 0;
+    count sampleSize = 0;
+    count numberOfAdditions = 0;
+
+    // -- Private Class Methods
+    static uinteger64 seedForRow(count row)
+    {
+        static const uinteger64 seeds[numberOfRows] = { 0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                                        0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL };
+        return seeds[row];
+    }
+
+    // -- Private Instance Methods
+    count counterIndexForHashInRow(uinteger64 hash, count row) const
+    {
+        uinteger64 rowHash = (hash + seedForRow(row)) * seedForRow(row);
+        rowHash += rowHash >> 32;
+        return rowHash & this->counterMask;
+    }
+
+    uinteger64 counterAt(count index) const
+    {
+        return (this->counters[index / countersPerWord] >> ((index % countersPerWord) * 4)) & maximumCounterValue;
+    }
+
+    void incrementCounterAt(count index)
+    {
+        this->counters[index / countersPerWord] += uinteger64(1) << ((index % countersPerWord) * 4);
+    }
 
-    void resizeCache(size_t nth)
+    void halveAllCounters()
     {
-        List& list = *this;
-        limit = nth;
-        while (list.size() > limit) {
-            map.erase(list.back().first);
-            list.pop_back();
+        for (auto& word : this->counters) {
+            word = (word >> 1) & 0x7777777777777777ULL;
         }
+
+        this->numberOfAdditions /= 2;
     }
 
-    typename List::iterator find(const K& k)
+public:
+    // -- Instance Methods
+    void resizeForNumberOfEntries(count numberOfEntries)
     {
-        auto found = map.find(k);
-        if (found == std::end(map)) {
-#ifdef LUR_TRACK_HITS
-            misses++;
-#endif
-            return std::end(*this);
+        if (numberOfEntries > maximumNumberOfTrackedEntries) {
+            numberOfEntries = maximumNumberOfTrackedEntries;
+        }
+        else if (!numberOfEntries) {
+            numberOfEntries = 1;
+        }
+
+        // -- One word, so sixteen counters shared by the rows, for each entry the cache can hold.
+        count numberOfWords = 1;
+        while (numberOfWords < numberOfEntries) {
+            numberOfWords *= 2;
         }
-        auto copy = found->second->second;
-        insert(k, copy);
-#ifdef LUR_TRACK_HITS
-        hits++;
-#endif
-        return std::begin(*this);
+
+        this->counters.assign(numberOfWords, 0);
+        this->counterMask = (numberOfWords * countersPerWord) - 1;
+        this->sampleSize = numberOfEntries * 10;
+        this->numberOfAdditions = 0;
     }
 
-    typename List::iterator insert(const K& k, const V& v)
+    count frequencyForHash(uinteger64 hash) const
     {
-        List& list = *this;
-        auto found = map.find(k);
-        if (found == std::end(map)) {
-            list.emplace_front(k, v);
-#ifdef LUR_TRACK_HITS
-            misses++;
-#endif
-            map.emplace(k, std::begin(list));
-            if (list.size() > limit) {
-                map.erase(list.back().first);
-                list.pop_back();
+        if (this->counters.empty()) {
+            return 0;
+        }
+
+        uinteger64 frequency = maximumCounterValue;
+        for (count row = 0; row < numberOfRows; ++row) {
+            frequency = std::min(frequency, this->counterAt(this->counterIndexForHashInRow(hash, row)));
+        }
+
+        return frequency;
+    }
+
+    void recordAccessForHash(uinteger64 hash)
+    {
+        if (this->counters.empty()) {
+            return;
+        }
+
+        // -- Conservative update, only the counters holding the current estimate are incremented.
+        auto frequency = this->frequencyForHash(hash);
+        if (frequency == maximumCounterValue) {
+            return;
+        }
+
+        for (count row = 0; row < numberOfRows; ++row) {
+            auto index = this->counterIndexForHashInRow(hash, row);
+            if (this->counterAt(index) == frequency) {
+                this->incrementCounterAt(index);
             }
-            found = map.find(k);
+        }
+
+        if (++this->numberOfAdditions >= this->sampleSize) {
+            this->halveAllCounters();
+        }
+    }
+
+    boolean shouldAdmitCandidateWithHashOverVictimWithHash(uinteger64 candidateHash, uinteger64 victimHash) const
+    {
+        return this->frequencyForHash(candidateHash) > this->frequencyForHash(victimHash);
+    }
+};
+
+// -- Least-recently-used cache. Entries are stored in intrusive doubly-linked nodes which are indexed by an
+// -- open-addressing hash table, so lookups are O(1) and promoting an entry only relinks its node.
+// -- Once the cache is full, the node of the evicted entry is reused for the new one. Room for as many nodes as the cache
+// -- can hold is reserved before the first one is added, so references to a cached value stay valid until its entry
+// -- is evicted or erased, or the cache is resized.
+// -- Besides the number of entries, the cache can be limited by the total cost of its entries (for example
+// -- their size in bytes) as computed by a user-supplied cost function.
+// -- The policy decides whether a new entry is worth evicting the least recently used one when the cache is full.
+template <typename K, typename V, typename Policy = LruEvictionPolicy>
+class LruCache
+{
+    // -- Constants
+    static constexpr uinteger32 noNode = std::numeric_limits<uinteger32>::max();
+    static constexpr count noSlot = std::numeric_limits<count>::max();
+    static constexpr count minimumNumberOfSlots = 8;
+
+    // -- Private Types
+    struct Node
+    {
+        Optional<std::pair<K, V>> entry;
+        uinteger64 hash = 0;
+        count cost = 0;
+        uinteger32 previous = noNode;
+        uinteger32 next = noNode;
+    };
+
+    // -- Counters are only ever modified by the thread using the cache so a relaxed load and store is enough,
+    // -- the atomic only makes sure that other threads reading them never see a torn value.
+    class Counter
+    {
+        std::atomic<count> value{ 0 };
+
+    public:
+        // -- Constructors/Destructors
+        Counter() = default;
+        Counter(const Counter& other) : value{ other.get() } { }
+
+        // -- Operators
+        Counter& operator=(const Counter& other)
+        {
+            this->value.store(other.get(), std::memory_order_relaxed);
+            return *this;
+        }
+
+        // -- Instance Methods
+        count get() const
+        {
+            return this->value.load(std::memory_order_relaxed);
+        }
+
+        void add(count amount)
+        {
+            this->value.store(this->get() + amount, std::memory_order_relaxed);
+        }
+
+        void subtract(count amount)
+        {
+            this->value.store(this->get() - amount, std::memory_order_relaxed);
+        }
+    };
+
+    template <typename Cache, typename Entry>
+    class Iterator
+    {
+        friend LruCache;
+
+        Cache* cache;
+        uinteger32 index;
+
+    public:
+        // -- Types
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<K, V>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Entry*;
+        using reference = Entry&;
+
+        // -- Constructors/Destructors
+        Iterator(Cache* withCache, uinteger32 withIndex) : cache{ withCache }, index{ withIndex } { }
+        template <typename OtherCache, typename OtherEntry>
+        Iterator(const Iterator<OtherCache, OtherEntry>& other) : cache{ other.cache }, index{ other.index } { }
+
+        // -- Operators
+        reference operator*() const
+        {
+            return *this->cache->nodes[this->index].entry;
+        }
+
+        pointer operator->() const
+        {
+            return &*this->cache->nodes[this->index].entry;
+        }
+
+        Iterator& operator++()
+        {
+            this->index = this->cache->nodes[this->index].next;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        template <typename OtherCache, typename OtherEntry>
+        bool operator==(const Iterator<OtherCache, OtherEntry>& other) const
+        {
+            return (this->index == other.index) && (this->cache == other.cache);
+        }
+
+        template <typename OtherCache, typename OtherEntry>
+        bool operator!=(const Iterator<OtherCache, OtherEntry>& other) const
+        {
+            return !this->operator==(other);
+        }
+
+        template <typename OtherCache, typename OtherEntry>
+        friend class Iterator;
+    };
+
+    // -- Private Instance Variables
+    std::vector<Node> nodes;
+    std::vector<uinteger32> slots;
+    uinteger32 firstFreeNode = noNode;
+    uinteger32 mostRecentNode = noNode;
+    uinteger32 leastRecentNode = noNode;
+    Counter numberOfEntries;
+    count limit = 0;
+    Counter totalCostOfEntries;
+    count maximumTotalCost = std::numeric_limits<count>::max();
+    std::function<count(const K&, const V&)> costFunction;
+    std::function<void(const K&, const V&)> evictionCallback;
+    Policy policy;
+    boolean statisticsAreEnabled = false;
+    Counter numberOfHits;
+    Counter numberOfMisses;
+    Counter numberOfInsertions;
+    Counter numberOfEvictions;
+    Counter numberOfRejections;
+    Counter totalEvictedCost;
+    Optional<V> valueNotCached;
+    Optional<uinteger64> hashOfLastMiss;
+
+    // -- Private Instance Methods
+    count slotMask() const
+    {
+        return this->slots.size() - 1;
+    }
+
+    count slotForKeyWithHash(const K& key, uinteger64 hash) const
+    {
+        if (!this->numberOfEntries.get()) {
+            return noSlot;
+        }
+
+        auto mask = this->slotMask();
+        for (count slot = hash & mask; ; slot = (slot + 1) & mask) {
+            auto nodeIndex = this->slots[slot];
+            if (nodeIndex == noNode) {
+                return noSlot;
+            }
+
+            auto& node = this->nodes[nodeIndex];
+            if ((node.hash == hash) && (node.entry->first == key)) {
+                return slot;
+            }
+        }
+    }
+
+    count slotForNodeAt(uinteger32 nodeIndex) const
+    {
+        auto mask = this->slotMask();
+        for (count slot = this->nodes[nodeIndex].hash & mask; ; slot = (slot + 1) & mask) {
+            NXA_ASSERT_TRUE(this->slots[slot] != noNode);
+            if (this->slots[slot] == nodeIndex) {
+                return slot;
+            }
+        }
+    }
+
+    void addNodeAtToSlots(uinteger32 nodeIndex)
+    {
+        auto mask = this->slotMask();
+        count slot = this->nodes[nodeIndex].hash & mask;
+        while (this->slots[slot] != noNode) {
+            slot = (slot + 1) & mask;
+        }
+
+        this->slots[slot] = nodeIndex;
+    }
+
+    void removeSlot(count slot)
+    {
+        // -- Backward-shift deletion keeps probe sequences intact without needing tombstones.
+        auto mask = this->slotMask();
+        count hole = slot;
+        for (count next = (hole + 1) & mask; this->slots[next] != noNode; next = (next + 1) & mask) {
+            count home = this->nodes[this->slots[next]].hash & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                this->slots[hole] = this->slots[next];
+                hole = next;
+            }
+        }
+
+        this->slots[hole] = noNode;
+    }
+
+    void makeRoomInSlotsForNumberOfEntries(count wantedNumberOfEntries)
+    {
+        // -- The table is kept at most half full so that probe sequences stay short.
+        if ((wantedNumberOfEntries * 2) <= this->slots.size()) {
+            return;
+        }
+
+        count numberOfSlots = minimumNumberOfSlots;
+        while (numberOfSlots < (wantedNumberOfEntries * 2)) {
+            numberOfSlots *= 2;
+        }
+
+        this->slots.assign(numberOfSlots, noNode);
+        for (auto nodeIndex = this->mostRecentNode; nodeIndex != noNode; nodeIndex = this->nodes[nodeIndex].next) {
+            this->addNodeAtToSlots(nodeIndex);
+        }
+    }
+
+    void unlinkNodeAt(uinteger32 nodeIndex)
+    {
+        auto& node = this->nodes[nodeIndex];
+
+        if (node.previous != noNode) {
+            this->nodes[node.previous].next = node.next;
+        }
+        else {
+            this->mostRecentNode = node.next;
+        }
+
+        if (node.next != noNode) {
+            this->nodes[node.next].previous = node.previous;
         }
         else {
-            list.erase(found->second);
-#ifdef LUR_TRACK_HITS
-            hits++;
-#endif
-            list.emplace_front(k, v);
-            found->second = std::begin(list);
+            this->leastRecentNode = node.previous;
         }
 
-        return found->second;
+        node.previous = noNode;
+        node.next = noNode;
+    }
+
+    void linkNodeAtAsMostRecent(uinteger32 nodeIndex)
+    {
+        auto& node = this->nodes[nodeIndex];
+        node.previous = noNode;
+        node.next = this->mostRecentNode;
+
+        if (this->mostRecentNode != noNode) {
+            this->nodes[this->mostRecentNode].previous = nodeIndex;
+        }
+        else {
+            this->leastRecentNode = nodeIndex;
+        }
+
+        this->mostRecentNode = nodeIndex;
+    }
+
+    void promoteNodeAt(uinteger32 nodeIndex)
+    {
+        if (nodeIndex == this->mostRecentNode) {
+            return;
+        }
+
+        this->unlinkNodeAt(nodeIndex);
+        this->linkNodeAtAsMostRecent(nodeIndex);
+    }
+
+    uinteger32 newNodeIndex()
+    {
+        if (this->firstFreeNode != noNode) {
+            auto nodeIndex = this->firstFreeNode;
+            this->firstFreeNode = this->nodes[nodeIndex].next;
+            return nodeIndex;
+        }
+
+        NXA_ASSERT_TRUE(this->nodes.size() < noNode);
+        if (this->nodes.capacity() < this->limit) {
+            // -- Adding a node must never move the existing ones, references to their values would dangle.
+            this->nodes.reserve(this->limit);
+        }
+
+        this->nodes.emplace_back();
+        return static_cast<uinteger32>(this->nodes.size() - 1);
+    }
+
+    void removeNodeAt(uinteger32 nodeIndex)
+    {
+        this->removeSlot(this->slotForNodeAt(nodeIndex));
+        this->unlinkNodeAt(nodeIndex);
+
+        auto& node = this->nodes[nodeIndex];
+        node.entry = nothing;
+        node.next = this->firstFreeNode;
+        this->firstFreeNode = nodeIndex;
+
+        this->totalCostOfEntries.subtract(node.cost);
+        this->numberOfEntries.subtract(1);
+    }
+
+    count costOfEntry(const K& key, const V& value) const
+    {
+        return this->costFunction ? this->costFunction(key, value) : 1;
+    }
+
+    void recordEvictionOfNodeAt(uinteger32 nodeIndex)
+    {
+        if (this->statisticsAreEnabled) {
+            this->numberOfEvictions.add(1);
+            this->totalEvictedCost.add(this->nodes[nodeIndex].cost);
+        }
+    }
+
+    void evictNodeAt(uinteger32 nodeIndex)
+    {
+        this->recordEvictionOfNodeAt(nodeIndex);
+
+        if (this->evictionCallback) {
+            auto& entry = *this->nodes[nodeIndex].entry;
+            this->evictionCallback(entry.first, entry.second);
+        }
+
+        this->removeNodeAt(nodeIndex);
+    }
+
+    void evictLeastRecentlyUsedEntriesToFitTheLimits()
+    {
+        while ((this->numberOfEntries.get() > this->limit) || (this->totalCostOfEntries.get() > this->maximumTotalCost)) {
+            this->evictNodeAt(this->leastRecentNode);
+        }
+    }
+
+    // -- Same as find() and insert(), for a key whose hash is known and whose access was already recorded. They
+    // -- return the index of the entry's node or noNode if the entry isn't cached.
+    uinteger32 nodeForKeyWithHash(const K& k, uinteger64 hash)
+    {
+        auto slot = this->slotForKeyWithHash(k, hash);
+        if (slot == noSlot) {
+            if (this->statisticsAreEnabled) {
+                this->numberOfMisses.add(1);
+            }
+
+            return noNode;
+        }
+
+        auto nodeIndex = this->slots[slot];
+        this->promoteNodeAt(nodeIndex);
+        if (this->statisticsAreEnabled) {
+            this->numberOfHits.add(1);
+        }
+
+        return nodeIndex;
+    }
+
+    uinteger32 nodeByInsertingWithHash(const K& k, const V& v, uinteger64 hash)
+    {
+        auto slot = this->slotForKeyWithHash(k, hash);
+        auto cost = this->costOfEntry(k, v);
+        if (slot != noSlot) {
+            auto nodeIndex = this->slots[slot];
+            auto& node = this->nodes[nodeIndex];
+            node.entry->second = v;
+            this->totalCostOfEntries.subtract(node.cost);
+            this->totalCostOfEntries.add(cost);
+            node.cost = cost;
+            this->promoteNodeAt(nodeIndex);
+            this->evictLeastRecentlyUsedEntriesToFitTheLimits();
+            return this->nodes[nodeIndex].entry ? nodeIndex : noNode;
+        }
+
+        auto cacheIsFull = (this->numberOfEntries.get() >= this->limit) ||
+                           (cost > (this->maximumTotalCost - this->totalCostOfEntries.get()));
+        auto shouldBeRejected = cacheIsFull && this->numberOfEntries.get() &&
+                                !this->policy.shouldAdmitCandidateWithHashOverVictimWithHash(hash, this->nodes[this->leastRecentNode].hash);
+        if (!this->limit || (cost > this->maximumTotalCost) || shouldBeRejected) {
+            // -- Entries which can never fit or which the policy rejects are handed straight to the eviction callback.
+            if (this->statisticsAreEnabled) {
+                this->numberOfRejections.add(1);
+            }
+
+            if (this->evictionCallback) {
+                this->evictionCallback(k, v);
+            }
+
+            return noNode;
+        }
+
+        uinteger32 nodeIndex;
+        if (this->numberOfEntries.get() >= this->limit) {
+            // -- Recycle the least recently used node, assigning over its entry lets the key and value reuse their storage.
+            nodeIndex = this->leastRecentNode;
+            this->recordEvictionOfNodeAt(nodeIndex);
+
+            if (this->evictionCallback) {
+                auto& entry = *this->nodes[nodeIndex].entry;
+                this->evictionCallback(entry.first, entry.second);
+            }
+
+            this->removeSlot(this->slotForNodeAt(nodeIndex));
+            this->unlinkNodeAt(nodeIndex);
+            this->totalCostOfEntries.subtract(this->nodes[nodeIndex].cost);
+
+            auto& entry = *this->nodes[nodeIndex].entry;
+            entry.first = k;
+            entry.second = v;
+        }
+        else {
+            this->makeRoomInSlotsForNumberOfEntries(this->numberOfEntries.get() + 1);
+
+            nodeIndex = this->newNodeIndex();
+            this->nodes[nodeIndex].entry.emplace(k, v);
+            this->numberOfEntries.add(1);
+        }
+
+        if (this->statisticsAreEnabled) {
+            this->numberOfInsertions.add(1);
+        }
+
+        auto& node = this->nodes[nodeIndex];
+        node.hash = hash;
+        node.cost = cost;
+        this->totalCostOfEntries.add(cost);
+        this->addNodeAtToSlots(nodeIndex);
+        this->linkNodeAtAsMostRecent(nodeIndex);
+
+        // -- The new entry fits on its own so only older entries can get evicted here.
+        this->evictLeastRecentlyUsedEntriesToFitTheLimits();
+
+        return nodeIndex;
+    }
+
+public:
+    // -- Types
+    using key_type = K;
+    using value_type = V;
+    using iterator = Iterator<LruCache, std::pair<K, V>>;
+    using const_iterator = Iterator<const LruCache, const std::pair<K, V>>;
+
+    // -- Class Methods
+    static uinteger64 hashFor(const K& key)
+    {
+        // -- Keys like integers hash to themselves so we mix the bits before using them to pick a slot.
+        uinteger64 hash = CacheKeyHasher<K>::hashFor(key);
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    // -- Instance Methods
+    iterator begin()
+    {
+        return { this, this->mostRecentNode };
+    }
+
+    iterator end()
+    {
+        return { this, noNode };
+    }
+
+    const_iterator begin() const
+    {
+        return { this, this->mostRecentNode };
+    }
+
+    const_iterator end() const
+    {
+        return { this, noNode };
+    }
+
+    const_iterator cbegin() const
+    {
+        return this->begin();
+    }
+
+    const_iterator cend() const
+    {
+        return this->end();
+    }
+
+    count size() const
+    {
+        return this->numberOfEntries.get();
+    }
+
+    boolean empty() const
+    {
+        return this->numberOfEntries.get() == 0;
+    }
+
+    count totalCost() const
+    {
+        return this->totalCostOfEntries.get();
+    }
+
+    void resizeCache(count nth)
+    {
+        this->limit = nth;
+        this->policy.resizeForNumberOfEntries(nth);
+        this->evictLeastRecentlyUsedEntriesToFitTheLimits();
+    }
+
+    void setMaximumTotalCost(count maximum)
+    {
+        this->maximumTotalCost = maximum;
+        this->evictLeastRecentlyUsedEntriesToFitTheLimits();
+    }
+
+    // -- Without a cost function, each entry costs 1.
+    void setCostFunction(std::function<count(const K&, const V&)> function)
+    {
+        this->costFunction = std::move(function);
+
+        this->totalCostOfEntries = { };
+        for (auto nodeIndex = this->mostRecentNode; nodeIndex != noNode; nodeIndex = this->nodes[nodeIndex].next) {
+            auto& node = this->nodes[nodeIndex];
+            node.cost = this->costOfEntry(node.entry->first, node.entry->second);
+            this->totalCostOfEntries.add(node.cost);
+        }
+
+        this->evictLeastRecentlyUsedEntriesToFitTheLimits();
+    }
+
+    // -- The callback is given each entry pushed out by the limits, right before it is removed. It must not modify the cache.
+    void setEvictionCallback(std::function<void(const K&, const V&)> callback)
+    {
+        this->evictionCallback = std::move(callback);
+    }
+
+    // -- Statistics are off by default, when disabled keeping them costs a single branch per operation.
+    void setStatisticsEnabled(boolean enabled)
+    {
+        this->statisticsAreEnabled = enabled;
+    }
+
+    boolean statisticsEnabled() const
+    {
+        return this->statisticsAreEnabled;
+    }
+
+    LruCacheStatistics statistics() const
+    {
+        LruCacheStatistics result;
+        result.numberOfHits = this->numberOfHits.get();
+        result.numberOfMisses = this->numberOfMisses.get();
+        result.numberOfInsertions = this->numberOfInsertions.get();
+        result.numberOfEvictions = this->numberOfEvictions.get();
+        result.numberOfRejections = this->numberOfRejections.get();
+        result.totalEvictedCost = this->totalEvictedCost.get();
+        result.numberOfEntries = this->numberOfEntries.get();
+        result.totalCost = this->totalCostOfEntries.get();
+
+        return result;
+    }
+
+    void resetStatistics()
+    {
+        this->numberOfHits = { };
+        this->numberOfMisses = { };
+        this->numberOfInsertions = { };
+        this->numberOfEvictions = { };
+        this->numberOfRejections = { };
+        this->totalEvictedCost = { };
+    }
+
+    iterator find(const K& k)
+    {
+        auto hash = LruCache::hashFor(k);
+        this->policy.recordAccessForHash(hash);
+
+        auto nodeIndex = this->nodeForKeyWithHash(k, hash);
+        if (nodeIndex == noNode) {
+            this->hashOfLastMiss = hash;
+            return this->end();
+        }
+
+        this->hashOfLastMiss = nothing;
+        return { this, nodeIndex };
+    }
+
+    // -- Inserting a key right after find() missed it is part of the same lookup, so its access is only recorded once.
+    iterator insert(const K& k, const V& v)
+    {
+        auto hash = LruCache::hashFor(k);
+        auto accessWasRecordedByFind = (this->hashOfLastMiss == hash);
+        this->hashOfLastMiss = nothing;
+        if (!accessWasRecordedByFind) {
+            this->policy.recordAccessForHash(hash);
+        }
+
+        auto nodeIndex = this->nodeByInsertingWithHash(k, v, hash);
+        return (nodeIndex != noNode) ? iterator{ this, nodeIndex } : this->end();
     }
 
     void erase(const K& k)
     {
-        List& list = *this;
-        auto found = map.find(k);
-        if (found != std::end(map)) {
-            list.erase(found->second);
-            map.erase(found);
+        auto slot = this->slotForKeyWithHash(k, LruCache::hashFor(k));
+        if (slot != noSlot) {
+            this->removeNodeAt(this->slots[slot]);
         }
     }
 
     void clear()
     {
-        List& list = *this;
-        list.clear();
-        map.clear();
+        this->nodes.clear();
+        std::fill(this->slots.begin(), this->slots.end(), noNode);
+        this->firstFreeNode = noNode;
+        this->mostRecentNode = noNode;
+        this->leastRecentNode = noNode;
+        this->numberOfEntries = { };
+        this->totalCostOfEntries = { };
+        this->hashOfLastMiss = nothing;
     }
 
+    // -- Operators
+    // -- When the cache can't hold a new entry, because of its limits or because its policy doesn't admit it, the
+    // -- reference returned is to a value which is not cached and which is only valid until the next call.
     V& operator[](const K& k)
     {
-        auto found = find(k);
-        if (found == this->end()) {
-            return insert(k, V{})->second;
-        }
-        else {
-            return found->second;
+        auto hash = LruCache::hashFor(k);
+        this->policy.recordAccessForHash(hash);
+        this->hashOfLastMiss = nothing;
+
+        auto nodeIndex = this->nodeForKeyWithHash(k, hash);
+        if (nodeIndex == noNode) {
+            nodeIndex = this->nodeByInsertingWithHash(k, V{ }, hash);
+            if (nodeIndex == noNode) {
+                this->valueNotCached = V{ };
+                return *this->valueNotCached;
+            }
         }
+
+        return this->nodes[nodeIndex].entry->second;
     }
 
     const V& operator[](const K& k) const
     {
-        return find(k)->second;
+        // -- Const lookups can't promote the entry so they leave the recency order untouched.
+        auto slot = this->slotForKeyWithHash(k, LruCache::hashFor(k));
+        NXA_ASSERT_TRUE(slot != noSlot);
+
+        return this->nodes[this->slots[slot]].entry->second;
     }
 
     template <typename ostream>
     friend inline ostream& operator<<(ostream& os, const LruCache& self)
     {
         os << "LRU ";
-#if LUR_TRACK_HITS
-        os << "(hit-rate: " << double(self.hits) / double(self.hits + self.misses) << ") ";
-#endif
+        if (self.statisticsAreEnabled) {
+            os << "(hit-rate: " << self.statistics().hitRate() << ") ";
+        }
+
         os << "{";
         for (auto const& in : self) {
             os << std::endl;
@@ -148,5 +914,12 @@ public:
         return os;
     }
 };
-    
+
+template <typename K, typename V, typename Policy>
+constexpr uinteger32 LruCache<K, V, Policy>::noNode;
+template <typename K, typename V, typename Policy>
+constexpr count LruCache<K, V, Policy>::noSlot;
+template <typename K, typename V, typename Policy>
+constexpr count LruCache<K, V, Policy>::minimumNumberOfSlots;
+
 }
@@ -0,0 +1,163 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/MultiStringMatcher.hpp"
+
+using namespace NxA;
+
+// -- Constants
+
+constexpr uinteger32 MultiStringMatcher::transitionMatchesFlag;
+
+// -- Constructors/Destructors
+
+MultiStringMatcher::MultiStringMatcher(const Array<String>& patterns)
+{
+    // -- Each character found in a pattern gets its own column, all the others share column 0 which always leads
+    // -- back to the root state.
+    this->columnForCharacter.fill(0);
+    count numberOfCharacters = 0;
+    for (auto&& pattern : patterns) {
+        auto characters = reinterpret_cast<const byte*>(pattern.asUTF8());
+        numberOfCharacters += pattern.length();
+        for (count index = 0; index < pattern.length(); ++index) {
+            auto& column = this->columnForCharacter[characters[index]];
+            if (!column) {
+                column = static_cast<uinteger16>(this->numberOfColumns++);
+            }
+        }
+    }
+
+    NXA_ASSERT_TRUE(((numberOfCharacters + 1) * this->numberOfColumns) < MultiStringMatcher::transitionMatchesFlag);
+
+    // -- Build the trie of all the patterns. Missing transitions are left pointing to the root state for now.
+    auto numberOfColumns = this->numberOfColumns;
+    std::vector<uinteger32> nextStates(numberOfColumns, 0);
+    std::vector<std::vector<uinteger32>> patternsEndingAtState(1);
+
+    uinteger32 patternIndex = 0;
+    for (auto&& pattern : patterns) {
+        this->patternLengths.push_back(pattern.length());
+
+        if (pattern.isEmpty()) {
+            ++patternIndex;
+            continue;
+        }
+
+        auto characters = pattern.asUTF8();
+        uinteger32 state = 0;
+        for (count index = 0; index < pattern.length(); ++index) {
+            auto transitionIndex = (state * numberOfColumns) + this->columnForCharacter[static_cast<byte>(characters[index])];
+            if (!nextStates[transitionIndex]) {
+                nextStates[transitionIndex] = static_cast<uinteger32>(patternsEndingAtState.size());
+                patternsEndingAtState.emplace_back();
+                nextStates.resize(nextStates.size() + numberOfColumns, 0);
+            }
+
+            state = nextStates[transitionIndex];
+        }
+
+        patternsEndingAtState[state].push_back(patternIndex++);
+    }
+
+    // -- Visit the states breadth first, so that the fallback of each state, the state for the longest suffix of its
+    // -- text which is also in the trie, is complete before it is used. Missing transitions are then replaced by the
+    // -- ones of the fallback state, which turns the trie into a table with exactly one lookup per character.
+    auto numberOfStates = patternsEndingAtState.size();
+    std::vector<uinteger32> fallbackForState(numberOfStates, 0);
+    std::vector<uinteger32> statesToVisit;
+    statesToVisit.reserve(numberOfStates);
+
+    for (count column = 1; column < numberOfColumns; ++column) {
+        auto state = nextStates[column];
+        if (state) {
+            statesToVisit.push_back(state);
+        }
+    }
+
+    for (count visitIndex = 0; visitIndex < statesToVisit.size(); ++visitIndex) {
+        auto state = statesToVisit[visitIndex];
+        auto fallback = fallbackForState[state];
+
+        // -- A state also matches everything its fallback state matches.
+        auto& matches = patternsEndingAtState[state];
+        auto& fallbackMatches = patternsEndingAtState[fallback];
+        matches.insert(matches.end(), fallbackMatches.begin(), fallbackMatches.end());
+
+        for (count column = 1; column < numberOfColumns; ++column) {
+            auto& nextState = nextStates[(state * numberOfColumns) + column];
+            auto fallbackNextState = nextStates[(fallback * numberOfColumns) + column];
+            if (nextState) {
+                fallbackForState[nextState] = fallbackNextState;
+                statesToVisit.push_back(nextState);
+            }
+            else {
+                nextState = fallbackNextState;
+            }
+        }
+    }
+
+    this->firstMatchForState.reserve(numberOfStates + 1);
+    for (auto&& matches : patternsEndingAtState) {
+        this->firstMatchForState.push_back(static_cast<uinteger32>(this->matchedPatterns.size()));
+        this->matchedPatterns.insert(this->matchedPatterns.end(), matches.begin(), matches.end());
+    }
+
+    this->firstMatchForState.push_back(static_cast<uinteger32>(this->matchedPatterns.size()));
+
+    this->transitions.reserve(nextStates.size());
+    for (auto&& nextState : nextStates) {
+        auto transition = static_cast<uinteger32>(nextState * numberOfColumns);
+        if (!patternsEndingAtState[nextState].empty()) {
+            transition |= MultiStringMatcher::transitionMatchesFlag;
+        }
+
+        this->transitions.push_back(transition);
+    }
+}
+
+// -- Instance Methods
+
+boolean MultiStringMatcher::hasMatchIn(const StringView& text) const
+{
+    auto characters = text.data();
+    auto length = text.length();
+
+    uinteger32 transition = 0;
+    for (count index = 0; index < length; ++index) {
+        transition = this->transitionFor(transition, characters[index]);
+        if (transition & MultiStringMatcher::transitionMatchesFlag) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Array<MultiStringMatch> MultiStringMatcher::matchesIn(const StringView& text) const
+{
+    MutableArray<MultiStringMatch> results;
+    this->forEachMatchIn(text, [&results](const MultiStringMatch& match) {
+        results.append(match);
+    });
+
+    return { std::move(results) };
+}
@@ -0,0 +1,143 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Array.hpp>
+#include <Base/MutableArray.hpp>
+#include <Base/String.hpp>
+#include <Base/StringView.hpp>
+
+#include <array>
+#include <vector>
+
+namespace NxA {
+
+// -- A pattern found by a MultiStringMatcher.
+struct MultiStringMatch
+{
+    // -- Index of the pattern in the array the matcher was created with.
+    count patternIndex;
+
+    // -- Index of the first character of the match in the text.
+    count position;
+
+    // -- Class Methods
+    static const character* staticClassName()
+    {
+        return "MultiStringMatch";
+    }
+
+    // -- Operators
+    bool operator==(const MultiStringMatch& other) const
+    {
+        return (this->patternIndex == other.patternIndex) && (this->position == other.position);
+    }
+    bool operator!=(const MultiStringMatch& other) const
+    {
+        return !this->operator==(other);
+    }
+};
+
+// -- Finds any number of patterns in a text in a single pass, using an Aho-Corasick automaton compiled into a table
+// -- with one row per state. Characters which are not in any pattern all share the same column so the table stays
+// -- small. A matcher is never modified once created and can be used from several threads at the same time.
+class MultiStringMatcher
+{
+    // -- Private Constants
+    // -- Set on transitions which lead to a state matching at least one pattern.
+    static constexpr uinteger32 transitionMatchesFlag = uinteger32(1) << 31;
+
+    // -- Private Instance Variables
+    std::array<uinteger16, 256> columnForCharacter;
+    count numberOfColumns = 1;
+
+    // -- Transitions store the offset of the row of the next state, so that reading the text only needs one lookup
+    // -- per character, along with transitionMatchesFlag.
+    std::vector<uinteger32> transitions;
+
+    // -- Patterns matched when reaching each state, stored as consecutive ranges of a single array.
+    std::vector<uinteger32> firstMatchForState;
+    std::vector<uinteger32> matchedPatterns;
+
+    std::vector<count> patternLengths;
+
+    // -- Private Instance Methods
+    uinteger32 transitionFor(uinteger32 transition, character value) const
+    {
+        return this->transitions[(transition & ~MultiStringMatcher::transitionMatchesFlag) + this->columnForCharacter[static_cast<byte>(value)]];
+    }
+
+public:
+    // -- Constructors/Destructors
+    // -- Empty patterns are never matched.
+    explicit MultiStringMatcher(const Array<String>&);
+
+    // -- Instance Methods
+    count numberOfPatterns() const
+    {
+        return this->patternLengths.size();
+    }
+    count numberOfStates() const
+    {
+        return this->firstMatchForState.size() - 1;
+    }
+
+    boolean hasMatchIn(const StringView&) const;
+    boolean hasMatchIn(const String& text) const
+    {
+        return this->hasMatchIn(text.asStringView());
+    }
+
+    // -- Matches are returned in the order of the position of their last character.
+    Array<MultiStringMatch> matchesIn(const StringView&) const;
+    Array<MultiStringMatch> matchesIn(const String& text) const
+    {
+        return this->matchesIn(text.asStringView());
+    }
+
+    // -- Calls the function with each match as the text is read, without collecting them first.
+    template <typename Function>
+    void forEachMatchIn(const StringView& text, Function&& function) const
+    {
+        auto characters = text.data();
+        auto length = text.length();
+
+        uinteger32 transition = 0;
+        for (count index = 0; index < length; ++index) {
+            transition = this->transitionFor(transition, characters[index]);
+            if (!(transition & MultiStringMatcher::transitionMatchesFlag)) {
+                continue;
+            }
+
+            auto state = (transition & ~MultiStringMatcher::transitionMatchesFlag) / this->numberOfColumns;
+            auto firstMatch = this->firstMatchForState[state];
+            auto endOfMatches = this->firstMatchForState[state + 1];
+            for (auto match = firstMatch; match < endOfMatches; ++match) {
+                auto patternIndex = this->matchedPatterns[match];
+                function(MultiStringMatch{ patternIndex, index + 1 - this->patternLengths[patternIndex] });
+            }
+        }
+    }
+};
+
+}
@@ -50,6 +50,11 @@ MutableBlob MutableBlob::blobWithBase64String(const String& string)
     return { Internal::blobWithBase64String(string) };
 }
 
+MutableBlob MutableBlob::blobWithHexString(const String& string)
+{
+    return { Internal::blobWithHexString(string) };
+}
+
 MutableBlob MutableBlob::blobWithStringWithTerminator(const String& string)
 {
     return { Internal::blobWithStringWithTerminator(string) };
@@ -109,11 +114,26 @@ String MutableBlob::base64String() const
     return nxa_internal->base64String();
 }
 
+String MutableBlob::hexString() const
+{
+    return nxa_internal->hexString();
+}
+
 void MutableBlob::fillWithZeros()
 {
     return nxa_internal->fillWithZeros();
 }
 
+void MutableBlob::reserve(count capacity)
+{
+    nxa_internal->reserve(capacity);
+}
+
+count MutableBlob::capacity() const
+{
+    return nxa_internal->capacity();
+}
+
 void MutableBlob::append(const Blob& other)
 {
     return nxa_internal->append(*NXA_INTERNAL_OBJECT_FOR(other));
@@ -139,6 +159,11 @@ void MutableBlob::append(const character other)
     return nxa_internal->append(other);
 }
 
+void MutableBlob::appendZerosWithSize(count size)
+{
+    nxa_internal->appendZerosWithSize(size);
+}
+
 void MutableBlob::removeAll()
 {
     nxa_internal->removeAll();
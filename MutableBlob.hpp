@@ -23,6 +23,9 @@
 
 #include <Base/Types.hpp>
 #include <Base/WeakReference.hpp>
+#include <Base/Internal/StringJoiner.hpp>
+
+#include <algorithm>
 
 namespace NxA {
 
@@ -52,6 +55,7 @@ public:
     static MutableBlob blobWithCapacity(count);
     static MutableBlob blobWithMemoryAndSize(const byte*, count);
     static MutableBlob blobWithBase64String(const String&);
+    static MutableBlob blobWithHexString(const String&);
     static MutableBlob blobWithStringWithTerminator(const String&);
     static MutableBlob blobWithStringWithoutTerminator(const String&);
 
@@ -77,14 +81,35 @@ public:
 
     void fillWithZeros();
 
+    // -- Makes sure that the blob can grow to at least this size without reallocating its memory.
+    void reserve(count);
+    count capacity() const;
+
     Blob hash();
     String base64String() const;
+    String hexString() const;
 
     void append(const Blob&);
     void appendMemoryWithSize(const byte*, count);
     void appendWithStringTermination(const character*);
     void appendWithoutStringTermination(const character*);
     void append(const character);
+    void appendZerosWithSize(count);
+
+    // -- Appends the strings in the array, separated by the separator, without creating the joined string first.
+    template <typename ArrayType>
+    void appendArrayJoinedWith(const ArrayType& array, const StringView& separator)
+    {
+        // -- Grows the blob at least geometrically, so that appending many arrays doesn't reallocate each time.
+        auto neededSize = this->size() + StringJoiner::lengthOfArrayJoinedWith(array, separator);
+        if (neededSize > this->capacity()) {
+            this->reserve(std::max(neededSize, 2 * this->capacity()));
+        }
+
+        StringJoiner::forEachPieceOfArrayJoinedWith(array, separator, [this](const character* characters, count length) {
+            this->appendMemoryWithSize(reinterpret_cast<const byte*>(characters), length);
+        });
+    }
 
     void removeAll();
 
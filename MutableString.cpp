@@ -39,7 +39,7 @@ using namespace NxA;
 // -- Constructors/Destructors
 
 MutableString::MutableString() : std::shared_ptr<Internal>{ std::make_shared<Internal>() } { }
-MutableString::MutableString(const String& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other.asStdString()) } { }
+MutableString::MutableString(const String& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other.asUTF8(), other.length()) } { }
 MutableString::MutableString(const std::string& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other) } { }
 MutableString::MutableString(std::string&& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(std::move(other)) } { }
 MutableString::MutableString(const character* other, size_t size) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other, size) } { }
@@ -48,25 +48,19 @@ MutableString::MutableString(const character* other, size_t size) : std::shared_
 
 MutableString MutableString::stringWithUTF16(const Blob& other)
 {
-    return { Internal::stringWithUTF16(other) };
+    return MutableString{ Internal::stringWithUTF16(other) };
 }
 
 MutableString MutableString::stringWithRepeatedCharacter(count number, character specificChar)
 {
-    return { Internal::stringWithRepeatedCharacter(number, specificChar) };
-}
-
-template <template <typename> class Implementation>
-MutableString MutableString::stringByJoiningArrayWithString(const Array<String, Implementation>& array, String join)
-{
-    return { Internal::stringByJoiningArrayWithString(array, *NXA_INTERNAL_OBJECT_FOR(join)) };
+    return MutableString{ Internal::stringWithRepeatedCharacter(number, specificChar) };
 }
 
 // -- Operators
 
 bool MutableString::operator==(const String& other) const
 {
-    return nxa_internal->operator==(*NXA_INTERNAL_OBJECT_FOR(other));
+    return nxa_internal->operator==(other.asStringView());
 }
 
 bool MutableString::operator==(const character* other) const
@@ -113,12 +107,12 @@ const character* MutableString::asUTF8() const
 
 Blob MutableString::asUTF16() const
 {
-    return nxa_internal->asUTF16();
+    return Internal::asUTF16For(StringView{ *nxa_internal });
 }
 
 void MutableString::append(const String& other)
 {
-    nxa_internal->append(*NXA_INTERNAL_OBJECT_FOR(other));
+    nxa_internal->append(other.asStringView());
 }
 
 void MutableString::append(const character* other)
@@ -133,32 +127,36 @@ void MutableString::append(character other)
 
 Array<String> MutableString::splitBySeparator(character separator) const
 {
-    return nxa_internal->splitBySeparator(separator);
+    return Internal::splitBySeparatorIn(StringView{ *nxa_internal }, separator);
 }
 
 MutableString MutableString::utfSeek(count skip) const
 {
-    return { nxa_internal->utfSeek(skip) };
+    auto rest = Internal::utfSeekIn(StringView{ *nxa_internal }, skip);
+    return { rest.data(), rest.length() };
 }
 
 MutableString MutableString::subString(count start, count end) const
 {
-    return { nxa_internal->subString(start, end) };
+    NXA_ASSERT_TRUE(start <= end);
+
+    auto part = StringView{ *nxa_internal }.subString(start, end);
+    return { part.data(), part.length() };
 }
 
 MutableString MutableString::lowerCaseString() const
 {
-    return { nxa_internal->lowerCaseString() };
+    return MutableString{ Internal::lowerCaseStringFor(StringView{ *nxa_internal }) };
 }
 
 MutableString MutableString::upperCaseString() const
 {
-    return { nxa_internal->upperCaseString() };
+    return MutableString{ Internal::upperCaseStringFor(StringView{ *nxa_internal }) };
 }
 
 boolean MutableString::hasPrefix(const String& prefix) const
 {
-    return nxa_internal->hasPrefix(*NXA_INTERNAL_OBJECT_FOR(prefix));
+    return nxa_internal->hasPrefix(prefix.asStringView());
 }
 
 boolean MutableString::hasPrefix(const character* prefix) const
@@ -168,7 +166,7 @@ boolean MutableString::hasPrefix(const character* prefix) const
 
 boolean MutableString::hasPostfix(const String& postfix) const
 {
-    return nxa_internal->hasPostfix(*NXA_INTERNAL_OBJECT_FOR(postfix));
+    return nxa_internal->hasPostfix(postfix.asStringView());
 }
 
 boolean MutableString::hasPostfix(const character* postfix) const
@@ -178,7 +176,7 @@ boolean MutableString::hasPostfix(const character* postfix) const
 
 boolean MutableString::contains(const String& other) const
 {
-    return nxa_internal->contains(*NXA_INTERNAL_OBJECT_FOR(other));
+    return nxa_internal->contains(other.asStringView());
 }
 
 boolean MutableString::contains(const character* other) const
@@ -188,7 +186,12 @@ boolean MutableString::contains(const character* other) const
 
 boolean MutableString::hasNonPrintableCharacters() const
 {
-    return nxa_internal->hasNonPrintableCharacters();
+    return Internal::hasNonPrintableCharactersIn(StringView{ *nxa_internal });
+}
+
+boolean MutableString::isValidUTF8() const
+{
+    return Internal::isValidUTF8In(StringView{ *nxa_internal });
 }
 
 count MutableString::indexOfFirstOccurenceOf(const String& other) const
@@ -215,3 +218,13 @@ void MutableString::replaceOccurenceOfStringWith(const character* occurence, con
 {
     return nxa_internal->replaceOccurenceOfStringWith(occurence, replacement);
 }
+
+void MutableString::convertToLowerCase()
+{
+    nxa_internal->convertToLowerCase();
+}
+
+void MutableString::convertToUpperCase()
+{
+    nxa_internal->convertToUpperCase();
+}
@@ -56,9 +56,18 @@ public:
 
     // -- Factory Methods
     template <typename... FormatArguments>
-    static MutableString stringWithFormat(const MutableString& format, FormatArguments&&... formatArguments)
+    static MutableString stringWithFormat(const String& format, const FormatArguments&... formatArguments)
     {
-        return MutableString{ Internal::stringWithFormat(256, format.asUTF8(), Internal::stringArgumentAsCharacter(formatArguments)...) };
+        std::string result;
+        StringFormatter::appendFormattedTo(result, format.asStringView(), formatArguments...);
+        return MutableString{ std::move(result) };
+    }
+    template <count size, typename... FormatArguments>
+    static MutableString stringWithFormat(const character (&format)[size], const FormatArguments&... formatArguments)
+    {
+        std::string result;
+        StringFormatter::appendFormattedTo(result, StringView{ format }, formatArguments...);
+        return MutableString{ std::move(result) };
     }
 
     static MutableString stringWith(const character* other)
@@ -70,8 +79,18 @@ public:
 
     static MutableString stringWithRepeatedCharacter(count, character);
 
-    template <template <typename> class Implementation>
-    static MutableString stringByJoiningArrayWithString(const Array<String, Implementation>&, String);
+    template <typename ArrayType>
+    static MutableString stringByJoiningArrayWithString(const ArrayType& array, String join)
+    {
+        return MutableString{ StringJoiner::stdStringByJoiningArrayWith(array, join.asStringView()) };
+    }
+
+    // -- For very large arrays, this splits the copies between several threads. The array needs random access iterators.
+    template <typename ArrayType>
+    static MutableString stringByJoiningArrayWithStringInParallel(const ArrayType& array, String join)
+    {
+        return MutableString{ StringJoiner::stdStringByJoiningArrayInParallelWith(array, join.asStringView()) };
+    }
 
     // -- Operators
     bool operator==(const String& other) const;
@@ -117,10 +136,17 @@ public:
     void append(character);
 
     template <typename... FormatArguments>
-    void appendStringWithFormat(const MutableString& formatString, FormatArguments&&... formatArguments)
+    void appendStringWithFormat(const String& formatString, const FormatArguments&... formatArguments)
+    {
+        // -- The result is formatted in place, at the end of our own characters.
+        StringFormatter::appendFormattedTo(*nxa_internal, formatString.asStringView(), formatArguments...);
+        nxa_internal->invalidateCachedHash();
+    }
+    template <count size, typename... FormatArguments>
+    void appendStringWithFormat(const character (&format)[size], const FormatArguments&... formatArguments)
     {
-        auto formatted = Internal::stringWithFormat(4096, formatString.asUTF8(), Internal::stringArgumentAsCharacter(formatArguments)...);
-        this->append(String{formatted});
+        StringFormatter::appendFormattedTo(*nxa_internal, StringView{ format }, formatArguments...);
+        nxa_internal->invalidateCachedHash();
     }
 
     Array<String> splitBySeparator(char) const;
@@ -136,6 +162,7 @@ public:
     boolean contains(const String&) const;
     boolean contains(const character*) const;
     boolean hasNonPrintableCharacters() const;
+    boolean isValidUTF8() const;
 
     count indexOfFirstOccurenceOf(const String&) const;
     count indexOfFirstOccurenceOf(const character*) const;
@@ -143,6 +170,8 @@ public:
     count indexOfLastOccurenceOf(const character*) const;
 
     void replaceOccurenceOfStringWith(const character*, const character*);
+    void convertToLowerCase();
+    void convertToUpperCase();
 };
     
 }
@@ -23,12 +23,18 @@
 #include "Base/String.hpp"
 #include "Base/Array.hpp"
 #include "Base/Internal/MutableStringInternal.hpp"
+#include "Base/Internal/NormalizedTextReader.hpp"
 #include "Base/MutableString.hpp"
 #include "Base/Exception.hpp"
 #include "Base/Platform.hpp"
 #include "Base/Assert.hpp"
 #include "Base/Describe.hpp"
 
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+
 using namespace NxA;
 
 // -- SBox Hash Implementation
@@ -71,68 +77,346 @@ inline NxA::uinteger32 SBox(const NxA::byte* key, NxA::count len, NxA::uinteger3
     return h;
 }
 
-#define NXA_OBJECT_CLASS                            String
-#define NXA_INTERNAL_OBJECT_SHOULD_NOT_BE_COPIED
-#define NXA_OBJECT_HAS_A_CUSTOM_CLASS_NAME
+// -- 64-bit Hash Implementation
+
+// Based on the wyhash algorithm (final version 4); source: https://github.com/wangyi-fudan/wyhash
+// This reads the string 8 bytes at a time in native byte order so, unlike SBox, values should not be persisted.
+
+static const NxA::uinteger64 wyhashSecret[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+static inline void wyhashMultiply(NxA::uinteger64& a, NxA::uinteger64& b)
+{
+    // -- Replaces a and b with the low and high halves of their 128-bit product.
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    a = static_cast<NxA::uinteger64>(product);
+    b = static_cast<NxA::uinteger64>(product >> 64);
+#else
+    NxA::uinteger64 aHigh = a >> 32, aLow = static_cast<NxA::uinteger32>(a);
+    NxA::uinteger64 bHigh = b >> 32, bLow = static_cast<NxA::uinteger32>(b);
+    NxA::uinteger64 lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+    NxA::uinteger64 middle = (lowLow >> 32) + static_cast<NxA::uinteger32>(lowHigh) + static_cast<NxA::uinteger32>(highLow);
+    a = (middle << 32) | static_cast<NxA::uinteger32>(lowLow);
+    b = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+static inline NxA::uinteger64 wyhashMultiplyAndFold(NxA::uinteger64 a, NxA::uinteger64 b)
+{
+    wyhashMultiply(a, b);
+    return a ^ b;
+}
+
+static inline NxA::uinteger64 wyhashRead64(const NxA::byte* p)
+{
+    NxA::uinteger64 value;
+    ::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline NxA::uinteger64 wyhashRead32(const NxA::byte* p)
+{
+    NxA::uinteger32 value;
+    ::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static NxA::uinteger64 wyhash(const NxA::byte* p, NxA::count length, NxA::uinteger64 seed)
+{
+    seed ^= wyhashMultiplyAndFold(seed ^ wyhashSecret[0], wyhashSecret[1]);
+
+    NxA::uinteger64 a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            a = (wyhashRead32(p) << 32) | wyhashRead32(p + ((length >> 3) << 2));
+            b = (wyhashRead32(p + length - 4) << 32) | wyhashRead32(p + length - 4 - ((length >> 3) << 2));
+        }
+        else if (length > 0) {
+            a = (NxA::uinteger64(p[0]) << 16) | (NxA::uinteger64(p[length >> 1]) << 8) | p[length - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        NxA::count remaining = length;
+        if (remaining > 48) {
+            NxA::uinteger64 seed1 = seed, seed2 = seed;
+            do {
+                seed = wyhashMultiplyAndFold(wyhashRead64(p) ^ wyhashSecret[1], wyhashRead64(p + 8) ^ seed);
+                seed1 = wyhashMultiplyAndFold(wyhashRead64(p + 16) ^ wyhashSecret[2], wyhashRead64(p + 24) ^ seed1);
+                seed2 = wyhashMultiplyAndFold(wyhashRead64(p + 32) ^ wyhashSecret[3], wyhashRead64(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16) {
+            seed = wyhashMultiplyAndFold(wyhashRead64(p) ^ wyhashSecret[1], wyhashRead64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+
+        a = wyhashRead64(p + remaining - 16);
+        b = wyhashRead64(p + remaining - 8);
+    }
+
+    a ^= wyhashSecret[1];
+    b ^= seed;
+
+    wyhashMultiply(a, b);
+
+    return wyhashMultiplyAndFold(a ^ wyhashSecret[0] ^ length, b ^ wyhashSecret[1]);
+}
+
+// -- Intern Table Implementation
 
-#include <Base/ObjectDefinition.ipp>
+// -- The table is split in shards, each with its own lock, so that threads interning different strings rarely contend.
+struct InternTableShard
+{
+    std::mutex lock;
+    std::unordered_multimap<NxA::uinteger32, std::shared_ptr<MutableStringInternal>> entries;
+};
+
+static constexpr NxA::count numberOfInternTableShards = 32;
+
+static InternTableShard& internTableShardForHash(NxA::uinteger32 hash)
+{
+    // -- Never destroyed, so that interned strings held by other static objects stay valid until the very end.
+    static auto shards = new InternTableShard[numberOfInternTableShards];
+    return shards[hash % numberOfInternTableShards];
+}
+
+// -- Normalization Implementation
+
+// -- Normalizing is slow enough that even a few thousand strings are worth splitting between threads.
+static constexpr NxA::count minimumNumberOfStringsNormalizedPerThread = 1024;
+
+static String normalizedString(const String& string)
+{
+    auto text = string.asStringView();
+    if (NormalizedTextReader::isInNormalizedForm(text)) {
+        return string;
+    }
+
+    return String{ NormalizedTextReader::normalizedFormOf(text, false) };
+}
+
+// -- Constants
+
+constexpr count String::maximumInlineLength;
+constexpr uinteger8 String::lengthOfASharedString;
 
 // -- Constructors/Destructors
 
-String::String() : std::shared_ptr<Internal>{ std::make_shared<Internal>() } { }
-String::String(const std::string& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other) } { }
-String::String(const std::string&& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(std::move(other)) } { }
-String::String(const character* other, size_t size) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other, size) } { }
-String::String(const MutableString& other) : std::shared_ptr<Internal>{ std::make_shared<Internal>(other.asStdString()) } { }
-String::String(MutableString&& other) : std::shared_ptr<Internal>{ std::move(other) }
+String::String() { }
+String::String(const std::string& other) : String{ other.data(), other.length() } { }
+String::String(std::string&& other)
+{
+    if (other.length() <= String::maximumInlineLength) {
+        this->setCharactersAndLength(other.data(), other.length());
+    }
+    else {
+        this->setSharedInternal(std::make_shared<Internal>(std::move(other)));
+    }
+}
+String::String(const character* other, size_t size)
+{
+    NXA_ASSERT_NOT_NULL(other);
+
+    if (size <= String::maximumInlineLength) {
+        this->setCharactersAndLength(other, size);
+    }
+    else {
+        this->setSharedInternal(std::make_shared<Internal>(other, size));
+    }
+}
+String::String(const StringView& other) : String{ other.data(), other.length() } { }
+String::String(const MutableString& other) : String{ other.asStdString() } { }
+String::String(MutableString&& other) : String{ std::move(static_cast<std::shared_ptr<Internal>&>(other)) }
 {
     // -- If we're moving this other mutable, it can't be referred to by anyone else.
-    NXA_ASSERT_TRUE(this->use_count() == 1);
+    NXA_ASSERT_TRUE(!this->isShared() || (this->sharedInternal.use_count() == 1));
+}
+String::String(std::shared_ptr<Internal>&& other)
+{
+    NXA_ASSERT_NOT_NULL(other.get());
+
+    if (other->length() <= String::maximumInlineLength) {
+        this->setCharactersAndLength(other->data(), other->length());
+    }
+    else {
+        this->setSharedInternal(std::move(other));
+    }
+}
+String::String(const String& other)
+{
+    this->copyContentOf(other);
+}
+String::String(String&& other)
+{
+    this->moveContentOf(other);
+}
+String::String(String& other) : String{ static_cast<const String&>(other) } { }
+String::~String()
+{
+    this->releaseSharedInternal();
+}
+
+// -- Protected Instance Methods
+
+void String::setCharactersAndLength(const character* characters, count length)
+{
+    NXA_ASSERT_FALSE(this->isShared());
+    NXA_ASSERT_TRUE(length <= String::maximumInlineLength);
+
+    ::memcpy(this->inlineCharacters, characters, length);
+    this->inlineCharacters[length] = 0;
+    this->inlineLength = static_cast<uinteger8>(length);
+}
+
+void String::setSharedInternal(std::shared_ptr<Internal>&& internal)
+{
+    NXA_ASSERT_FALSE(this->isShared());
+
+    new (&this->sharedInternal) std::shared_ptr<Internal>{ std::move(internal) };
+    this->inlineLength = String::lengthOfASharedString;
+}
+
+void String::releaseSharedInternal()
+{
+    if (!this->isShared()) {
+        return;
+    }
+
+    this->sharedInternal.~shared_ptr();
+    this->inlineCharacters[0] = 0;
+    this->inlineLength = 0;
+}
+
+void String::copyContentOf(const String& other)
+{
+    if (other.isShared()) {
+        this->setSharedInternal(std::shared_ptr<Internal>{ other.sharedInternal });
+        return;
+    }
+
+    ::memcpy(this->inlineCharacters, other.inlineCharacters, sizeof(this->inlineCharacters));
+    this->inlineLength = other.inlineLength;
+}
+
+void String::moveContentOf(String& other)
+{
+    if (other.isShared()) {
+        this->setSharedInternal(std::move(other.sharedInternal));
+        other.releaseSharedInternal();
+        return;
+    }
+
+    ::memcpy(this->inlineCharacters, other.inlineCharacters, sizeof(this->inlineCharacters));
+    this->inlineLength = other.inlineLength;
 }
 
 // -- Factory Methods
 
 String String::stringWithUTF16AtAndSize(const byte* data, count size)
 {
-    return {Internal::stringWithUTF16AtAndSize(data, size)};
+    return String{ Internal::stringWithUTF16AtAndSize(data, size) };
 }
 
 String String::stringWithUTF16(const Blob& other)
 {
-    return {Internal::stringWithUTF16(other)};
+    return String{ Internal::stringWithUTF16(other) };
 }
 
 String String::stringWithRepeatedCharacter(count number, character specificChar)
 {
-    return {Internal::stringWithRepeatedCharacter(number, specificChar)};
+    return String{ Internal::stringWithRepeatedCharacter(number, specificChar) };
 }
 
 String String::stringByFilteringNonPrintableCharactersIn(const String& other)
 {
-    return {Internal::stringByFilteringNonPrintableCharactersIn(other)};
+    return String{ Internal::stringByFilteringNonPrintableCharactersIn(other) };
+}
+
+String String::internedString(const String& other)
+{
+    if (other.isInterned()) {
+        return other;
+    }
+
+    auto hash = other.hash();
+    auto& shard = internTableShardForHash(hash);
+    std::lock_guard<std::mutex> guard(shard.lock);
+
+    // -- Interned strings always use a shared internal object, even short ones, since that's where they are flagged.
+    String result;
+
+    auto text = other.asStringView();
+    auto range = shard.entries.equal_range(hash);
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (*entry->second == text) {
+            result.setSharedInternal(std::shared_ptr<Internal>{ entry->second });
+            return result;
+        }
+    }
+
+    auto internal = std::make_shared<Internal>(text.data(), text.length());
+    internal->isInterned = true;
+    internal->cachedHash.store(Internal::cachedHashIsValid | hash, std::memory_order_relaxed);
+    shard.entries.emplace(hash, internal);
+
+    result.setSharedInternal(std::move(internal));
+    return result;
 }
 
 String String::stringWithUTF8(const character* other, UTF8Flag normalize)
 {
+    StringView text{ other, ::strlen(other) };
     if (normalize == UTF8Flag::NeedsNormalizing) {
-        size_t inputSize = ::strlen(other);
-
-        if (::utf8isnormalized(other, inputSize, UTF8_NORMALIZE_DECOMPOSE, NULL) != UTF8_NORMALIZATION_RESULT_YES) {
-            int32_t errors;
+        // -- Normalized in a single pass, ASCII text and text already in normalized form are only copied.
+        return String{ NormalizedTextReader::normalizedFormOf(text, false) };
+    }
 
-            size_t convertedSize = utf8normalize(other, inputSize, NULL, 0, UTF8_NORMALIZE_DECOMPOSE, &errors);
-            if ((convertedSize > 0) && (errors == UTF8_ERR_NONE)) {
-                std::string buffer;
-                buffer.resize(convertedSize);
+    return String{ text };
+}
 
-                utf8normalize(other, inputSize, &buffer[0], convertedSize, UTF8_NORMALIZE_DECOMPOSE, NULL);
+Array<String> String::stringsByNormalizingStringsInParallel(const Array<String>& strings)
+{
+    count numberOfStrings = strings.length();
+    std::vector<String> results(numberOfStrings);
 
-                return String{ std::move(buffer) };
-            }
+    auto normalizeRange = [&strings, &results](count rangeStart, count rangeEnd) {
+        for (auto index = rangeStart; index < rangeEnd; ++index) {
+            results[index] = normalizedString(strings[index]);
         }
+    };
+
+    count numberOfThreads = std::min<count>(std::max(std::thread::hardware_concurrency(), 1u),
+                                            numberOfStrings / minimumNumberOfStringsNormalizedPerThread);
+    if (numberOfThreads < 2) {
+        normalizeRange(0, numberOfStrings);
+        return { std::move(results) };
+    }
+
+    count numberOfStringsPerThread = (numberOfStrings + numberOfThreads - 1) / numberOfThreads;
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (count rangeStart = numberOfStringsPerThread; rangeStart < numberOfStrings; rangeStart += numberOfStringsPerThread) {
+        threads.emplace_back(normalizeRange, rangeStart, std::min(rangeStart + numberOfStringsPerThread, numberOfStrings));
+    }
+
+    normalizeRange(0, numberOfStringsPerThread);
+
+    for (auto&& thread : threads) {
+        thread.join();
     }
 
-    return { other, strlen(other) };
+    return { std::move(results) };
 }
 
 // -- Class Methods
@@ -144,6 +428,27 @@ uinteger32 String::hashFor(const character* string)
     return SBox((const byte*)string, strlen(string), uinteger32(-1));
 }
 
+uinteger32 String::hashFor(const character* string, count length)
+{
+    NXA_ASSERT_NOT_NULL(string);
+
+    return SBox((const byte*)string, length, uinteger32(-1));
+}
+
+uinteger64 String::hash64For(const character* string)
+{
+    NXA_ASSERT_NOT_NULL(string);
+
+    return wyhash((const byte*)string, strlen(string), 0);
+}
+
+uinteger64 String::hash64For(const character* string, count length)
+{
+    NXA_ASSERT_NOT_NULL(string);
+
+    return wyhash((const byte*)string, length, 0);
+}
+
 count String::lengthOf(const character* str)
 {
     NXA_ASSERT_NOT_NULL(str);
@@ -158,151 +463,289 @@ count String::lengthOf(const character* str)
 
 // -- Operators
 
+String& String::operator=(String&& other)
+{
+    if (this != &other) {
+        this->releaseSharedInternal();
+        this->moveContentOf(other);
+    }
+
+    return *this;
+}
+
+String& String::operator=(const String& other)
+{
+    if (this != &other) {
+        this->releaseSharedInternal();
+        this->copyContentOf(other);
+    }
+
+    return *this;
+}
+
+bool String::operator==(const String& other) const
+{
+    if (this->isShared() && other.isShared()) {
+        auto internal = this->sharedInternal.get();
+        auto otherInternal = other.sharedInternal.get();
+        if (internal == otherInternal) {
+            return true;
+        }
+
+        // -- Two different interned strings can never have the same content.
+        if (internal->isInterned && otherInternal->isInterned) {
+            return false;
+        }
+    }
+
+    return this->asStringView() == other.asStringView();
+}
+
 bool String::operator==(const character* other) const
 {
-    return nxa_internal->operator==(other);
+    return this->asStringView() == StringView::viewWithUTF8(other);
 }
 
 bool String::operator==(const MutableString& other) const
 {
-    return nxa_internal->operator==(*NXA_INTERNAL_OBJECT_FOR(other));
+    return this->asStringView() == StringView{ other.asStdString() };
 }
 
 // -- Instance Methods
 
+boolean String::classNameIs(const character* className) const
+{
+    return !::strcmp(String::staticClassNameConst, className);
+}
+
 String String::description(const DescriberState& state) const
 {
     return *this;
 }
 
+String String::description() const
+{
+    DescriberState state;
+    return this->description(state);
+}
+
 integer32 String::compare(const char* other) const
 {
-    return nxa_internal->compare(other);
+    return this->asStringView().compare(StringView::viewWithUTF8(other));
 }
 
 integer32 String::compare(const String& other) const
 {
-    return nxa_internal->compare(*NXA_INTERNAL_OBJECT_FOR(other));
+    return this->asStringView().compare(other.asStringView());
+}
+
+integer32 String::compareNormalized(const String& other) const
+{
+    return NormalizedTextReader::compareNormalizedFormsOf(this->asStringView(), other.asStringView(), false);
+}
+
+integer32 String::compareCaseInsensitive(const String& other) const
+{
+    return NormalizedTextReader::compareNormalizedFormsOf(this->asStringView(), other.asStringView(), true);
+}
+
+StringSortKey String::sortKey() const
+{
+    return StringSortKey{ NormalizedTextReader::normalizedFormOf(this->asStringView(), false) };
+}
+
+StringSortKey String::caseInsensitiveSortKey() const
+{
+    return StringSortKey{ NormalizedTextReader::normalizedFormOf(this->asStringView(), true) };
 }
 
 count String::length() const
 {
-    return nxa_internal->length();
+    return this->isShared() ? this->sharedInternal->length() : this->inlineLength;
 }
 
 uinteger32 String::hash() const
 {
-    return nxa_internal->hash();
+    // -- Only shared internal objects cache their hash, short strings are quick enough to hash again.
+    if (this->isShared()) {
+        return this->sharedInternal->hash();
+    }
+
+    return String::hashFor(this->inlineCharacters, this->inlineLength);
+}
+
+uinteger64 String::hash64() const
+{
+    auto text = this->asStringView();
+    return String::hash64For(text.data(), text.length());
+}
+
+boolean String::isInterned() const
+{
+    return this->isShared() && this->sharedInternal->isInterned;
 }
 
 integer String::integerValue() const
 {
-    return nxa_internal->integerValue();
+    return ::atoi(this->asUTF8());
 }
 
 decimal3 String::decimalValue() const
 {
-    return nxa_internal->decimalValue();
+    return decimal3(this->asStdString());
 }
 
-const std::string& String::asStdString() const
+std::string String::asStdString() const
 {
-    return nxa_internal->asStdString();
+    return this->asStringView().asStdString();
 }
 
 const character* String::asUTF8() const
 {
-    return nxa_internal->asUTF8();
+    return this->isShared() ? this->sharedInternal->c_str() : this->inlineCharacters;
 }
 
 Blob String::asUTF16() const
 {
-    return nxa_internal->asUTF16();
+    return Internal::asUTF16For(this->asStringView());
+}
+
+StringView String::asStringView() const
+{
+    if (this->isShared()) {
+        return { this->sharedInternal->data(), this->sharedInternal->length() };
+    }
+
+    return { this->inlineCharacters, this->inlineLength };
+}
+
+StringView String::asPinnedStringView() const
+{
+    auto owner = this->isShared() ? this->sharedInternal : std::make_shared<Internal>(this->inlineCharacters, this->inlineLength);
+
+    auto characters = owner->data();
+    auto length = owner->length();
+    return { characters, length, std::move(owner) };
 }
 
 String String::stringByAppending(const String& other) const
 {
-    return { nxa_internal->stringByAppending(*NXA_INTERNAL_OBJECT_FOR(other)) };
+    if (other.isEmpty()) {
+        return *this;
+    }
+    else if (this->isEmpty()) {
+        return other;
+    }
+
+    // -- Short results fit in std::string's own buffer so they are built without allocating anything.
+    auto text = this->asStringView();
+    auto otherText = other.asStringView();
+
+    std::string result;
+    result.reserve(text.length() + otherText.length());
+    result.append(text.data(), text.length());
+    result.append(otherText.data(), otherText.length());
+
+    return String{ std::move(result) };
 }
 
 Array<String> String::splitBySeparator(character separator) const
 {
-    return { nxa_internal->splitBySeparator(separator) };
+    return { Internal::splitBySeparatorIn(this->asStringView(), separator) };
+}
+
+StringViewSplitter String::splitViewsBySeparator(character separator) const
+{
+    return this->asStringView().splitBySeparator(separator);
 }
 
 String String::utfSeek(count skip) const
 {
-    return { nxa_internal->utfSeek(skip) };
+    return String{ Internal::utfSeekIn(this->asStringView(), skip) };
 }
 
 String String::subString(count start, count end) const
 {
-    return { nxa_internal->subString(start, end) };
+    NXA_ASSERT_TRUE(start <= end);
+
+    return String{ this->asStringView().subString(start, end) };
+}
+
+StringView String::subStringView(count start, count end) const
+{
+    NXA_ASSERT_TRUE(start <= end);
+
+    return this->asStringView().subString(start, end);
 }
 
 String String::lowerCaseString() const
 {
-    return { nxa_internal->lowerCaseString() };
+    return String{ Internal::lowerCaseStringFor(this->asStringView()) };
 }
 
 String String::upperCaseString() const
 {
-    return nxa_internal->upperCaseString();
+    return String{ Internal::upperCaseStringFor(this->asStringView()) };
 }
 
 NxA::boolean String::hasPrefix(const String& prefix) const
 {
-    return nxa_internal->hasPrefix(*NXA_INTERNAL_OBJECT_FOR(prefix));
+    return this->asStringView().hasPrefix(prefix.asStringView());
 }
 
 NxA::boolean String::hasPrefix(const character* prefix) const
 {
-    return nxa_internal->hasPrefix(prefix);
+    return this->asStringView().hasPrefix(StringView::viewWithUTF8(prefix));
 }
 
 NxA::boolean String::hasPostfix(const String& postfix) const
 {
-    return nxa_internal->hasPostfix(*NXA_INTERNAL_OBJECT_FOR(postfix));
+    return this->asStringView().hasPostfix(postfix.asStringView());
 }
 
 NxA::boolean String::hasPostfix(const character* postfix) const
 {
-    return nxa_internal->hasPostfix(postfix);
+    return this->asStringView().hasPostfix(StringView::viewWithUTF8(postfix));
 }
 
 NxA::boolean String::contains(const String& other) const
 {
-    return nxa_internal->contains(*NXA_INTERNAL_OBJECT_FOR(other));
+    return this->asStringView().contains(other.asStringView());
 }
 
 NxA::boolean String::contains(const character* other) const
 {
-    return nxa_internal->contains(other);
+    return this->asStringView().contains(StringView::viewWithUTF8(other));
 }
 
 NxA::boolean String::hasNonPrintableCharacters() const
 {
-    return nxa_internal->hasNonPrintableCharacters();
+    return Internal::hasNonPrintableCharactersIn(this->asStringView());
+}
+
+NxA::boolean String::isValidUTF8() const
+{
+    return Internal::isValidUTF8In(this->asStringView());
 }
 
 count String::indexOfFirstOccurenceOf(const String& other) const
 {
-    return nxa_internal->indexOfFirstOccurenceOf(other);
+    return this->asStringView().indexOfFirstOccurenceOf(other.asStringView());
 }
 
 count String::indexOfFirstOccurenceOf(const character* other) const
 {
-    return nxa_internal->indexOfFirstOccurenceOf(other);
+    return this->asStringView().indexOfFirstOccurenceOf(StringView::viewWithUTF8(other));
 }
 
 count String::indexOfLastOccurenceOf(const String& other) const
 {
-    return nxa_internal->indexOfLastOccurenceOf(other);
+    return this->asStringView().indexOfLastOccurenceOf(other.asStringView());
 }
 
 count String::indexOfLastOccurenceOf(const character* other) const
 {
-    return nxa_internal->indexOfLastOccurenceOf(other);
+    return this->asStringView().indexOfLastOccurenceOf(StringView::viewWithUTF8(other));
 }
 
 // -- Operators
@@ -311,8 +754,7 @@ namespace NxA {
 
 bool operator<(const String& first, const String& second)
 {
-    using Internal = MutableStringInternal;
-    return *NXA_INTERNAL_OBJECT_FOR(first) < *NXA_INTERNAL_OBJECT_FOR(second);
+    return first.asStringView() < second.asStringView();
 }
 
 String operator"" _String(const character* str, count length)
@@ -22,6 +22,11 @@
 #pragma once
 
 #include <Base/Types.hpp>
+#include <Base/StringView.hpp>
+#include <Base/StringSortKey.hpp>
+#include <Base/StringBuilder.hpp>
+#include <Base/Internal/StringFormatter.hpp>
+#include <Base/Internal/StringJoiner.hpp>
 #include <Base/Internal/MutableStringInternal.hpp>
 
 namespace NxA {
@@ -37,15 +42,50 @@ class MutableString;
 class Blob;
 
 // -- Public Interface
-class String : protected NXA_OBJECT
+// -- Unlike other objects, String doesn't always keep its internal object in a shared pointer. Short strings, which
+// -- are the most common ones, keep their characters in the space of the shared pointer so creating or copying them
+// -- never allocates anything. Longer strings share their internal object between copies since a String can never
+// -- be modified.
+class String
 {
-    #include <Base/ObjectDeclaration.ipp>
+    // -- Constants
+    // -- Short strings and their terminating null character use the space of the shared pointer, which is 16 bytes
+    // -- on 64-bit platforms.
+    static constexpr count maximumInlineLength = 15;
+    static constexpr uinteger8 lengthOfASharedString = 0xff;
+
+    // -- Private Instance Variables
+    union {
+        NXA_OBJECT sharedInternal;
+        character inlineCharacters[maximumInlineLength + 1] = { };
+    };
+    uinteger8 inlineLength = 0;
 
+protected:
+    // -- Forward declarations
+    using Internal = NXA_OBJECT_INTERNAL_CLASS;
+    friend Internal;
     friend MutableString;
-    friend bool operator<(const String&, const String&);
+
+    // -- Protected Constructors & Destructors
+    String(std::shared_ptr<Internal>&& other);
+
+    // -- Protected Instance Methods
+    boolean isShared() const
+    {
+        return this->inlineLength == String::lengthOfASharedString;
+    }
+
+    void setCharactersAndLength(const character*, count);
+    void setSharedInternal(std::shared_ptr<Internal>&&);
+    void releaseSharedInternal();
+    void copyContentOf(const String&);
+    void moveContentOf(String&);
 
 public:
     // -- Constants
+    static constexpr auto staticClassNameConst = "String";
+
     enum class UTF8Flag {
         NeedsNormalizing,
         IsNormalized,
@@ -57,7 +97,12 @@ public:
     String(MutableString&&);
     String(const MutableString&);
     explicit String(const std::string&);
-    explicit String(const std::string&&);
+    explicit String(std::string&&);
+    explicit String(const StringView&);
+    String(const String&);
+    String(String&&);
+    String(String&);
+    ~String();
 
     // -- Provide a statically-sized character constant, which saves the runtime from computing the length.
     template <count size>
@@ -65,15 +110,32 @@ public:
 
     // -- Factory Methods
     template <typename... FormatArguments>
-    static String stringWithFormat(const String& format, FormatArguments&&... formatArguments)
+    static String stringWithFormat(const String& format, const FormatArguments&... formatArguments)
     {
-        return String{Internal::stringWithFormat(256, format.asUTF8(), Internal::stringArgumentAsCharacter(formatArguments)...)};
+        std::string result;
+        StringFormatter::appendFormattedTo(result, format.asStringView(), formatArguments...);
+        return String{ std::move(result) };
     }
 
+    // -- Formats given as string literals are used as they are, without creating a String for them first.
+    template <count size, typename... FormatArguments>
+    static String stringWithFormat(const character (&format)[size], const FormatArguments&... formatArguments)
+    {
+        std::string result;
+        StringFormatter::appendFormattedTo(result, StringView{ format }, formatArguments...);
+        return String{ std::move(result) };
+    }
+
+    // -- Without any arguments the format is not parsed, so that text like "100%" is used as it is.
     static String stringWithFormat(const String& format)
     {
         return format;
     }
+    template <count size>
+    static String stringWithFormat(const character (&format)[size])
+    {
+        return String{ format };
+    }
 
     static String stringWithUTF8(const character* other, UTF8Flag normalize = UTF8Flag::IsNormalized);
     static String stringWithMemoryAndLength(const character* other, count length)
@@ -89,17 +151,49 @@ public:
 
     static String stringByFilteringNonPrintableCharactersIn(const String&);
 
+    // -- Returns the strings in decomposed (NFD) form, like stringWithUTF8() with NeedsNormalizing, splitting the work
+    // -- between several threads for large arrays. Strings already in normalized form are returned without a copy.
+    static Array<String> stringsByNormalizingStringsInParallel(const Array<String>&);
+
+    // -- Returns the canonical copy of a string, shared by all interned strings with the same content. Comparing
+    // -- two interned strings only compares pointers and their hash is cached. Interned strings are never freed.
+    static String internedString(const String&);
+
     template <typename ArrayType>
     static String stringByJoiningArrayWithString(const ArrayType& array, String join)
     {
-        return { Internal::stringByJoiningArrayWithString(array, *NXA_INTERNAL_OBJECT_FOR(join)) };
+        return String{ StringJoiner::stdStringByJoiningArrayWith(array, join.asStringView()) };
+    }
+
+    // -- For very large arrays, this splits the copies between several threads. The array needs random access iterators.
+    template <typename ArrayType>
+    static String stringByJoiningArrayWithStringInParallel(const ArrayType& array, String join)
+    {
+        return String{ StringJoiner::stdStringByJoiningArrayInParallelWith(array, join.asStringView()) };
     }
 
     // -- Class Methods
+    static const character* staticClassName()
+    {
+        return String::staticClassNameConst;
+    }
+
+    // -- hashFor() uses the original SBox hash and should be used for any hash that is persisted. hash64For() is
+    // -- much faster on long strings and collides less, but its values can differ between platforms.
     static uinteger32 hashFor(const character*);
+    static uinteger32 hashFor(const character*, count);
+    static uinteger64 hash64For(const character*);
+    static uinteger64 hash64For(const character*, count);
     static count lengthOf(const character* str);
 
     // -- Operators
+    String& operator=(String&&);
+    String& operator=(const String&);
+    bool operator==(const String& other) const;
+    inline bool operator!=(const String& other) const
+    {
+        return !this->operator==(other);
+    }
     bool operator==(const character*) const;
     inline bool operator!=(const character* other) const
     {
@@ -116,26 +210,49 @@ public:
     {
         return String::staticClassNameConst;
     }
-    
+    boolean classNameIs(const character* className) const;
+
+    String description(const DescriberState&) const;
+    String description() const;
+
     count length() const;
     boolean isEmpty() const
     {
         return this->length() == 0;
     }
     uinteger32 hash() const;
+    uinteger64 hash64() const;
+    boolean isInterned() const;
     integer32 compare(const String& other) const;
     integer32 compare(const char* other) const;
+
+    // -- These compare the decomposed forms of the strings, without creating any copies of them unless they contain
+    // -- non-ASCII characters. Case insensitive comparisons also ignore differences in normalization.
+    integer32 compareNormalized(const String& other) const;
+    integer32 compareCaseInsensitive(const String& other) const;
+    StringSortKey sortKey() const;
+    StringSortKey caseInsensitiveSortKey() const;
+
     integer integerValue() const;
     decimal3 decimalValue() const;
 
-    const std::string& asStdString() const;
+    // -- Short strings don't have a std::string to refer to, so this returns a copy.
+    std::string asStdString() const;
     const character* asUTF8() const;
     Blob asUTF16() const;
 
+    // -- The view is only valid as long as this string is. A pinned view keeps the characters alive on its own, which
+    // -- only allocates if this string is short enough to be stored inline.
+    StringView asStringView() const;
+    StringView asPinnedStringView() const;
+
     String stringByAppending(const String&) const;
 
     Array<String> splitBySeparator(char) const;
+    // -- The views are only valid as long as this string is.
+    StringViewSplitter splitViewsBySeparator(character) const;
     String subString(count, count = -1) const;
+    StringView subStringView(count, count = -1) const;
     String utfSeek(count) const;
     String lowerCaseString() const;
     String upperCaseString() const;
@@ -147,6 +264,7 @@ public:
     boolean contains(const String&) const;
     boolean contains(const character*) const;
     boolean hasNonPrintableCharacters() const;
+    boolean isValidUTF8() const;
 
     count indexOfFirstOccurenceOf(const String&) const;
     count indexOfLastOccurenceOf(const String&) const;
@@ -156,10 +274,15 @@ public:
     template <typename Char, typename CharTraits>
     friend inline ::std::basic_ostream<Char, CharTraits>& operator<<(::std::basic_ostream<Char, CharTraits>& os, const String& self)
     {
-        return (os << self.asStdString());
+        return (os << self.asStringView());
     }
 };
 
+#undef NXA_OBJECT
+#undef NXA_OBJECT_CLASS
+#undef NXA_OBJECT_INTERNAL_CLASS
+#undef NXA_OBJECT_HAS_A_CUSTOM_CLASS_NAME
+
 // -- Operators
 bool operator<(const String&, const String&);
 String operator"" _String(const character* str, count length);
@@ -0,0 +1,146 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/StringBuilder.hpp"
+#include "Base/String.hpp"
+#include "Base/MutableString.hpp"
+
+using namespace NxA;
+
+// -- Constants
+
+constexpr count StringBuilder::minimumChunkSize;
+constexpr count StringBuilder::maximumChunkSize;
+constexpr count StringBuilder::minimumLengthOfKeptStrings;
+
+// -- Instance Methods
+
+void StringBuilder::startANewChunkWithAtLeast(count size)
+{
+    auto chunkSize = std::max(this->nextChunkSize, size);
+
+    this->chunks.emplace_back(new character[chunkSize]);
+    this->currentChunk = this->chunks.back().get();
+    this->currentChunkSize = chunkSize;
+    this->currentChunkUsed = 0;
+    this->lastPieceIsInTheCurrentChunk = false;
+
+    // -- Chunks grow with the builder so that large results don't end up in thousands of tiny chunks.
+    this->nextChunkSize = std::min(this->nextChunkSize * 2, StringBuilder::maximumChunkSize);
+}
+
+void StringBuilder::reserve(count length)
+{
+    if ((this->currentChunkSize - this->currentChunkUsed) < length) {
+        this->startANewChunkWithAtLeast(length);
+    }
+}
+
+character* StringBuilder::charactersAppendedWithLength(count length)
+{
+    if ((this->currentChunkSize - this->currentChunkUsed) < length) {
+        this->startANewChunkWithAtLeast(length);
+    }
+
+    auto result = this->currentChunk + this->currentChunkUsed;
+    this->currentChunkUsed += length;
+    this->totalLength += length;
+
+    // -- Consecutive appends to the same chunk end up as one piece.
+    if (this->lastPieceIsInTheCurrentChunk) {
+        auto& lastPiece = this->pieces.back();
+        lastPiece = StringView{ lastPiece.data(), lastPiece.length() + length };
+    }
+    else {
+        this->pieces.emplace_back(result, length);
+        this->lastPieceIsInTheCurrentChunk = true;
+    }
+
+    return result;
+}
+
+void StringBuilder::append(const StringView& other)
+{
+    auto length = other.length();
+    if (length != 0) {
+        ::memcpy(this->charactersAppendedWithLength(length), other.data(), length);
+    }
+}
+
+void StringBuilder::append(const String& other)
+{
+    auto length = other.length();
+    if (length < StringBuilder::minimumLengthOfKeptStrings) {
+        this->append(other.asStringView());
+        return;
+    }
+
+    // -- Long strings are never stored inline so pinning them only keeps a reference to their characters.
+    this->pieces.emplace_back(other.asPinnedStringView());
+    this->lastPieceIsInTheCurrentChunk = false;
+    this->totalLength += length;
+}
+
+void StringBuilder::append(const MutableString& other)
+{
+    // -- A mutable string can change after being appended so its characters have to be copied right away.
+    this->append(StringView{ other.asUTF8(), other.length() });
+}
+
+void StringBuilder::append(const character* other)
+{
+    NXA_ASSERT_NOT_NULL(other);
+    this->append(StringView{ other, ::strlen(other) });
+}
+
+void StringBuilder::append(character other)
+{
+    this->append(StringView{ &other, 1 });
+}
+
+void StringBuilder::appendRepeatedCharacter(count number, character other)
+{
+    if (number != 0) {
+        ::memset(this->charactersAppendedWithLength(number), other, number);
+    }
+}
+
+std::string StringBuilder::asStdString() const
+{
+    std::string result;
+    result.reserve(this->totalLength);
+
+    for (auto&& piece : this->pieces) {
+        result.append(piece.data(), piece.length());
+    }
+
+    return result;
+}
+
+String StringBuilder::asString() const
+{
+    return String{ this->asStdString() };
+}
+
+MutableString StringBuilder::asMutableString() const
+{
+    return MutableString{ this->asStdString() };
+}
@@ -0,0 +1,128 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/StringView.hpp>
+#include <Base/Uncopyable.hpp>
+#include <Base/Internal/StringFormatter.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NxA {
+
+// -- Forward Declarations
+class String;
+class MutableString;
+
+// -- Assembles a string from many pieces and only copies them once, into the final string. Short pieces are copied
+// -- into chunks which are never moved or resized while long strings are kept as they are until the end. Unlike
+// -- appending to a MutableString, the cost of an append does not depend on how much was already appended.
+class StringBuilder : private Uncopyable
+{
+    // -- Private Constants
+    static constexpr count minimumChunkSize = 256;
+    static constexpr count maximumChunkSize = 64 * 1024;
+
+    // -- Strings longer than this are kept instead of being copied into a chunk.
+    static constexpr count minimumLengthOfKeptStrings = 256;
+
+    // -- Private Instance Variables
+    std::vector<StringView> pieces;
+    std::vector<std::unique_ptr<character[]>> chunks;
+
+    character* currentChunk = nullptr;
+    count currentChunkSize = 0;
+    count currentChunkUsed = 0;
+    count nextChunkSize = StringBuilder::minimumChunkSize;
+    boolean lastPieceIsInTheCurrentChunk = false;
+
+    count totalLength = 0;
+
+    // -- Reused by each formatted append so that formatting does not allocate once the builder is warmed up.
+    std::string formattingBuffer;
+
+    // -- Private Instance Methods
+    void startANewChunkWithAtLeast(count);
+
+    // -- Returns where the given number of characters must be written.
+    character* charactersAppendedWithLength(count);
+
+public:
+    // -- Constructors/Destructors
+    StringBuilder() = default;
+    explicit StringBuilder(count expectedLength)
+    {
+        this->reserve(expectedLength);
+    }
+    ~StringBuilder() override = default;
+
+    // -- Instance Methods
+    count length() const
+    {
+        return this->totalLength;
+    }
+    boolean isEmpty() const
+    {
+        return this->totalLength == 0;
+    }
+
+    // -- This is a hint that at least this many more characters will be appended, which lets the builder copy
+    // -- them without starting any new chunk.
+    void reserve(count);
+
+    void append(const StringView&);
+    void append(const String&);
+    void append(const MutableString&);
+    void append(const character*);
+    void append(character);
+    void appendRepeatedCharacter(count, character);
+
+    template <typename... FormatArguments>
+    void appendStringWithFormat(const StringView& format, const FormatArguments&... formatArguments)
+    {
+        this->formattingBuffer.clear();
+        StringFormatter::appendFormattedTo(this->formattingBuffer, format, formatArguments...);
+        this->append(StringView{ this->formattingBuffer });
+    }
+
+    template <typename ArrayType>
+    void appendArrayJoinedWith(const ArrayType& array, const StringView& separator)
+    {
+        auto iterator = array.begin();
+        while (iterator != array.end()) {
+            this->append(*iterator);
+
+            if (++iterator != array.end()) {
+                this->append(separator);
+            }
+        }
+    }
+
+    std::string asStdString() const;
+    String asString() const;
+    MutableString asMutableString() const;
+};
+
+}
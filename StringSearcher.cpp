@@ -0,0 +1,350 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/StringSearcher.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define NXA_STRING_SEARCHER_HAS_SSE2
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__GNUC__)
+#include <immintrin.h>
+#define NXA_STRING_SEARCHER_HAS_AVX2
+#define NXA_STRING_SEARCHER_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+#endif
+
+using namespace NxA;
+
+// -- Constants
+
+constexpr count StringSearcher::maximumLengthOfShortNeedles;
+
+// -- Short Needle Implementation
+
+// -- Candidates are positions where both the first and the last characters of the needle match. Only those are
+// -- compared with the rest of the needle, which is rare in real text even for common first characters.
+static count indexOfFirstOccurenceOfShortNeedlePortable(const character* needle, count needleLength, const character* haystack,
+                                                        count haystackLength, count index = 0)
+{
+    auto lastIndex = haystackLength - needleLength;
+    auto firstCharacter = needle[0];
+    auto lastCharacter = needle[needleLength - 1];
+
+    while (index <= lastIndex) {
+        auto found = static_cast<const character*>(::memchr(haystack + index, firstCharacter, lastIndex - index + 1));
+        if (!found) {
+            break;
+        }
+
+        index = found - haystack;
+        if ((haystack[index + needleLength - 1] == lastCharacter) && !::memcmp(haystack + index + 1, needle + 1, needleLength - 2)) {
+            return index;
+        }
+
+        ++index;
+    }
+
+    return haystackLength;
+}
+
+#if defined(NXA_STRING_SEARCHER_HAS_SSE2)
+
+// -- Index of the lowest bit set in a non-zero mask.
+static inline count indexOfLowestBitSetIn(uinteger32 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+static count indexOfFirstOccurenceOfShortNeedleSSE2(const character* needle, count needleLength, const character* haystack, count haystackLength)
+{
+    auto firstCharacters = _mm_set1_epi8(needle[0]);
+    auto lastCharacters = _mm_set1_epi8(needle[needleLength - 1]);
+
+    count index = 0;
+    for (; (index + needleLength + 15) <= haystackLength; index += 16) {
+        auto firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + index));
+        auto lastBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + index + needleLength - 1));
+        auto mask = static_cast<uinteger32>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firstBlock, firstCharacters), _mm_cmpeq_epi8(lastBlock, lastCharacters))));
+        while (mask) {
+            auto candidate = index + indexOfLowestBitSetIn(mask);
+            if (!::memcmp(haystack + candidate + 1, needle + 1, needleLength - 2)) {
+                return candidate;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+
+    return indexOfFirstOccurenceOfShortNeedlePortable(needle, needleLength, haystack, haystackLength, index);
+}
+
+#endif
+
+#if defined(NXA_STRING_SEARCHER_HAS_AVX2)
+
+NXA_STRING_SEARCHER_AVX2_FUNCTION static count indexOfFirstOccurenceOfShortNeedleAVX2(const character* needle, count needleLength,
+                                                                                      const character* haystack, count haystackLength)
+{
+    auto firstCharacters = _mm256_set1_epi8(needle[0]);
+    auto lastCharacters = _mm256_set1_epi8(needle[needleLength - 1]);
+
+    count index = 0;
+    for (; (index + needleLength + 31) <= haystackLength; index += 32) {
+        auto firstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + index));
+        auto lastBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + index + needleLength - 1));
+        auto mask = static_cast<uinteger32>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, firstCharacters), _mm256_cmpeq_epi8(lastBlock, lastCharacters))));
+        while (mask) {
+            auto candidate = index + indexOfLowestBitSetIn(mask);
+            if (!::memcmp(haystack + candidate + 1, needle + 1, needleLength - 2)) {
+                return candidate;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+
+    return indexOfFirstOccurenceOfShortNeedlePortable(needle, needleLength, haystack, haystackLength, index);
+}
+
+static boolean processorSupportsAVX2()
+{
+    static const boolean supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif
+
+// -- Constructors/Destructors
+
+StringSearcher::StringSearcher(const StringView& withNeedle) : needle{ withNeedle.asStdString() }
+{
+    auto needleLength = this->needle.length();
+    if (needleLength <= StringSearcher::maximumLengthOfShortNeedles) {
+        return;
+    }
+
+    auto characters = reinterpret_cast<const byte*>(this->needle.data());
+
+    // -- The needle is split at its critical position, found from its maximal suffixes for both orderings of the
+    // -- alphabet. Indices start at -1, relying on unsigned arithmetic wrapping around like the reference implementation.
+    count leftIndex = -1;
+    count rightIndex = 0;
+    count offset = 1;
+    count currentPeriod = 1;
+    while ((rightIndex + offset) < needleLength) {
+        auto left = characters[leftIndex + offset];
+        auto right = characters[rightIndex + offset];
+        if (left == right) {
+            if (offset == currentPeriod) {
+                rightIndex += currentPeriod;
+                offset = 1;
+            }
+            else {
+                ++offset;
+            }
+        }
+        else if (left > right) {
+            rightIndex += offset;
+            offset = 1;
+            currentPeriod = rightIndex - leftIndex;
+        }
+        else {
+            leftIndex = rightIndex++;
+            offset = currentPeriod = 1;
+        }
+    }
+
+    auto maximalSuffix = leftIndex;
+    auto maximalSuffixPeriod = currentPeriod;
+
+    leftIndex = -1;
+    rightIndex = 0;
+    offset = 1;
+    currentPeriod = 1;
+    while ((rightIndex + offset) < needleLength) {
+        auto left = characters[leftIndex + offset];
+        auto right = characters[rightIndex + offset];
+        if (left == right) {
+            if (offset == currentPeriod) {
+                rightIndex += currentPeriod;
+                offset = 1;
+            }
+            else {
+                ++offset;
+            }
+        }
+        else if (left < right) {
+            rightIndex += offset;
+            offset = 1;
+            currentPeriod = rightIndex - leftIndex;
+        }
+        else {
+            leftIndex = rightIndex++;
+            offset = currentPeriod = 1;
+        }
+    }
+
+    if ((leftIndex + 1) > (maximalSuffix + 1)) {
+        maximalSuffix = leftIndex;
+    }
+    else {
+        currentPeriod = maximalSuffixPeriod;
+    }
+
+    this->criticalPosition = maximalSuffix;
+
+    if (::memcmp(characters, characters + currentPeriod, maximalSuffix + 1)) {
+        this->period = std::max(maximalSuffix, needleLength - maximalSuffix - 1) + 1;
+        this->periodicMemory = 0;
+    }
+    else {
+        // -- The needle is periodic so the part already matched after a shift doesn't need to be compared again.
+        this->period = currentPeriod;
+        this->periodicMemory = needleLength - currentPeriod;
+    }
+
+    // -- How far the needle can be moved based on the last character of the haystack window, as in Horspool's algorithm.
+    this->shifts.assign(256, 0);
+    for (count index = 0; index < needleLength; ++index) {
+        this->shifts[characters[index]] = static_cast<uinteger32>(index + 1);
+    }
+}
+
+// -- Class Methods
+
+count StringSearcher::indexOfFirstOccurenceOfShortNeedleIn(const StringView& needle, const StringView& haystack)
+{
+    auto needleLength = needle.length();
+    auto haystackLength = haystack.length();
+
+    if (needleLength == 1) {
+        return haystack.indexOfFirstOccurenceOf(needle[0]);
+    }
+
+#if defined(NXA_STRING_SEARCHER_HAS_AVX2)
+    if (processorSupportsAVX2()) {
+        return indexOfFirstOccurenceOfShortNeedleAVX2(needle.data(), needleLength, haystack.data(), haystackLength);
+    }
+#endif
+#if defined(NXA_STRING_SEARCHER_HAS_SSE2)
+    return indexOfFirstOccurenceOfShortNeedleSSE2(needle.data(), needleLength, haystack.data(), haystackLength);
+#else
+    return indexOfFirstOccurenceOfShortNeedlePortable(needle.data(), needleLength, haystack.data(), haystackLength);
+#endif
+}
+
+count StringSearcher::indexOfFirstOccurenceOfIn(const StringView& needle, const StringView& haystack)
+{
+    if (needle.isEmpty()) {
+        return 0;
+    }
+
+    if (needle.length() > haystack.length()) {
+        return haystack.length();
+    }
+
+    if (needle.length() <= StringSearcher::maximumLengthOfShortNeedles) {
+        return StringSearcher::indexOfFirstOccurenceOfShortNeedleIn(needle, haystack);
+    }
+
+    return StringSearcher{ needle }.indexOfFirstOccurenceOfLongNeedleIn(haystack);
+}
+
+// -- Instance Methods
+
+count StringSearcher::indexOfFirstOccurenceOfLongNeedleIn(const StringView& haystack) const
+{
+    auto characters = reinterpret_cast<const byte*>(this->needle.data());
+    auto needleLength = this->needle.length();
+    auto text = reinterpret_cast<const byte*>(haystack.data());
+    auto haystackLength = haystack.length();
+
+    count position = 0;
+    count memory = 0;
+    while ((haystackLength - position) >= needleLength) {
+        auto window = text + position;
+
+        auto shift = needleLength - this->shifts[window[needleLength - 1]];
+        if (shift) {
+            position += std::max(shift, memory);
+            memory = 0;
+            continue;
+        }
+
+        // -- Compare the right half of the needle first.
+        auto index = std::max(this->criticalPosition + 1, memory);
+        while ((index < needleLength) && (characters[index] == window[index])) {
+            ++index;
+        }
+
+        if (index < needleLength) {
+            position += index - this->criticalPosition;
+            memory = 0;
+            continue;
+        }
+
+        // -- Then the left half.
+        index = this->criticalPosition + 1;
+        while ((index > memory) && (characters[index - 1] == window[index - 1])) {
+            --index;
+        }
+
+        if (index <= memory) {
+            return position;
+        }
+
+        position += this->period;
+        memory = this->periodicMemory;
+    }
+
+    return haystackLength;
+}
+
+count StringSearcher::indexOfFirstOccurenceIn(const StringView& haystack) const
+{
+    auto needleLength = this->needle.length();
+    if (!needleLength) {
+        return 0;
+    }
+
+    if (needleLength > haystack.length()) {
+        return haystack.length();
+    }
+
+    if (needleLength <= StringSearcher::maximumLengthOfShortNeedles) {
+        return StringSearcher::indexOfFirstOccurenceOfShortNeedleIn(StringView{ this->needle }, haystack);
+    }
+
+    return this->indexOfFirstOccurenceOfLongNeedleIn(haystack);
+}
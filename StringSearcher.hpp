@@ -0,0 +1,73 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/StringView.hpp>
+
+#include <string>
+#include <vector>
+
+namespace NxA {
+
+// -- Looks for one needle in any number of haystacks. Everything which only depends on the needle is computed once
+// -- when the searcher is created, which makes it the cheapest way to look for the same text in many strings.
+// -- Short needles are found by comparing the first and last characters of the needle at many positions at once
+// -- and long ones with the Two-Way algorithm, which is linear even on repetitive text.
+class StringSearcher
+{
+    // -- Private Constants
+    static constexpr count maximumLengthOfShortNeedles = 32;
+
+    // -- Private Instance Variables
+    std::string needle;
+
+    // -- Two-Way state, only used for long needles.
+    count criticalPosition = 0;
+    count period = 0;
+    count periodicMemory = 0;
+    std::vector<uinteger32> shifts;
+
+    // -- Private Class Methods
+    static count indexOfFirstOccurenceOfShortNeedleIn(const StringView&, const StringView&);
+
+    // -- Private Instance Methods
+    count indexOfFirstOccurenceOfLongNeedleIn(const StringView&) const;
+
+public:
+    // -- Constructors/Destructors
+    explicit StringSearcher(const StringView&);
+
+    // -- Class Methods
+    // -- For a single search, this avoids preparing a searcher when the needle is short.
+    static count indexOfFirstOccurenceOfIn(const StringView&, const StringView&);
+
+    // -- Instance Methods
+    // -- Like String, this returns the length of the haystack if the needle cannot be found.
+    count indexOfFirstOccurenceIn(const StringView&) const;
+    boolean isFoundIn(const StringView& haystack) const
+    {
+        return this->indexOfFirstOccurenceIn(haystack) != haystack.length();
+    }
+};
+
+}
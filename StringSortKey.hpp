@@ -0,0 +1,80 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace NxA {
+
+// -- Binary form of a string, returned by String::sortKey() or String::caseInsensitiveSortKey(), which sorts in the
+// -- same order as String::compareNormalized() or String::compareCaseInsensitive() but only needs a memcmp() to be
+// -- compared. Computing the keys once makes sorting large arrays much cheaper than normalizing on each comparison.
+class StringSortKey
+{
+    // -- Private Instance Variables
+    std::string bytes;
+
+public:
+    // -- Constructors/Destructors
+    StringSortKey() = default;
+    explicit StringSortKey(std::string&& withBytes) : bytes{ std::move(withBytes) } { }
+
+    // -- Operators
+    bool operator==(const StringSortKey& other) const
+    {
+        return this->bytes == other.bytes;
+    }
+    bool operator!=(const StringSortKey& other) const
+    {
+        return !this->operator==(other);
+    }
+    bool operator<(const StringSortKey& other) const
+    {
+        return this->compare(other) < 0;
+    }
+
+    // -- Instance Methods
+    const byte* data() const
+    {
+        return reinterpret_cast<const byte*>(this->bytes.data());
+    }
+    count length() const
+    {
+        return this->bytes.length();
+    }
+
+    integer32 compare(const StringSortKey& other) const
+    {
+        auto result = ::memcmp(this->bytes.data(), other.bytes.data(), std::min(this->bytes.length(), other.bytes.length()));
+        if (result) {
+            return (result < 0) ? -1 : 1;
+        }
+
+        return (this->bytes.length() == other.bytes.length()) ? 0 : ((this->bytes.length() < other.bytes.length()) ? -1 : 1);
+    }
+};
+
+}
@@ -0,0 +1,48 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/StringView.hpp"
+#include "Base/String.hpp"
+#include "Base/StringSearcher.hpp"
+
+using namespace NxA;
+
+// -- Instance Methods
+
+uinteger32 StringView::hash() const
+{
+    return String::hashFor(this->characters, this->numberOfCharacters);
+}
+
+uinteger64 StringView::hash64() const
+{
+    return String::hash64For(this->characters, this->numberOfCharacters);
+}
+
+count StringView::indexOfFirstOccurenceOf(const StringView& other) const
+{
+    return StringSearcher::indexOfFirstOccurenceOfIn(other, *this);
+}
+
+String StringView::asString() const
+{
+    return { this->characters, this->numberOfCharacters };
+}
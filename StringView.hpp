@@ -0,0 +1,300 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <Base/Types.hpp>
+#include <Base/Assert.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace NxA {
+
+// -- Forward Declarations
+class String;
+class StringViewSplitter;
+
+// -- Public Interface
+// -- A view on a range of characters owned by something else, usually a String. Creating, copying or taking a
+// -- sub-string of a view never allocates. A view doesn't keep its characters alive unless it was pinned, so it must
+// -- not outlive the string it was created from. Unlike a String, the characters are not null-terminated.
+class StringView
+{
+    // -- Private Instance Variables
+    const character* characters = "";
+    count numberOfCharacters = 0;
+    std::shared_ptr<const void> owner;
+
+public:
+    // -- Constructors/Destructors
+    StringView() = default;
+    StringView(const character* withCharacters, count withLength) : characters{ withCharacters }, numberOfCharacters{ withLength }
+    {
+        NXA_ASSERT_NOT_NULL(withCharacters);
+    }
+    StringView(const character* withCharacters, count withLength, std::shared_ptr<const void> withOwner)
+        : characters{ withCharacters }, numberOfCharacters{ withLength }, owner{ std::move(withOwner) }
+    {
+        NXA_ASSERT_NOT_NULL(withCharacters);
+    }
+    explicit StringView(const std::string& other) : characters{ other.data() }, numberOfCharacters{ other.length() } { }
+
+    // -- Provide a statically-sized character constant, which saves the runtime from computing the length.
+    template <count size>
+    StringView(const character (&chars)[size]) : StringView{ chars, size - 1 } { }
+
+    // -- Factory Methods
+    static StringView viewWithUTF8(const character* other)
+    {
+        NXA_ASSERT_NOT_NULL(other);
+        return { other, ::strlen(other) };
+    }
+
+    // -- Operators
+    character operator[](count index) const
+    {
+        NXA_ASSERT_TRUE(index < this->numberOfCharacters);
+        return this->characters[index];
+    }
+    bool operator==(const StringView& other) const
+    {
+        return (this->numberOfCharacters == other.numberOfCharacters) &&
+               ((this->characters == other.characters) || !::memcmp(this->characters, other.characters, this->numberOfCharacters));
+    }
+    inline bool operator!=(const StringView& other) const
+    {
+        return !this->operator==(other);
+    }
+    bool operator<(const StringView& other) const
+    {
+        return this->compare(other) < 0;
+    }
+
+    // -- Instance Methods
+    const character* data() const
+    {
+        return this->characters;
+    }
+
+    count length() const
+    {
+        return this->numberOfCharacters;
+    }
+
+    boolean isEmpty() const
+    {
+        return this->numberOfCharacters == 0;
+    }
+
+    boolean isPinned() const
+    {
+        return this->owner != nullptr;
+    }
+
+    uinteger32 hash() const;
+    uinteger64 hash64() const;
+
+    integer32 compare(const StringView& other) const
+    {
+        auto result = ::memcmp(this->characters, other.characters, std::min(this->numberOfCharacters, other.numberOfCharacters));
+        if (result) {
+            return result;
+        }
+
+        return (this->numberOfCharacters < other.numberOfCharacters) ? -1 : (this->numberOfCharacters > other.numberOfCharacters) ? 1 : 0;
+    }
+
+    // -- Same arguments as String::subString(), the resulting view shares the characters and the owner of this one.
+    StringView subString(count start, count end = -1) const
+    {
+        if (end > this->numberOfCharacters) {
+            end = this->numberOfCharacters;
+        }
+
+        if (start >= end) {
+            return { this->characters + end, 0, this->owner };
+        }
+
+        return { this->characters + start, end - start, this->owner };
+    }
+
+    boolean hasPrefix(const StringView& prefix) const
+    {
+        return (prefix.numberOfCharacters <= this->numberOfCharacters) &&
+               !::memcmp(this->characters, prefix.characters, prefix.numberOfCharacters);
+    }
+
+    boolean hasPostfix(const StringView& postfix) const
+    {
+        return (postfix.numberOfCharacters <= this->numberOfCharacters) &&
+               !::memcmp(this->characters + this->numberOfCharacters - postfix.numberOfCharacters, postfix.characters, postfix.numberOfCharacters);
+    }
+
+    boolean contains(const StringView& other) const
+    {
+        // -- Like std::string::find(), an empty string is found in any string, even an empty one.
+        if (other.isEmpty()) {
+            return true;
+        }
+
+        return this->indexOfFirstOccurenceOf(other) != this->numberOfCharacters;
+    }
+
+    // -- Like String, these return the length of the view if the other string cannot be found.
+    count indexOfFirstOccurenceOf(const StringView& other) const;
+
+    count indexOfLastOccurenceOf(const StringView& other) const
+    {
+        auto end = this->characters + this->numberOfCharacters;
+        auto found = std::find_end(this->characters, end, other.characters, other.characters + other.numberOfCharacters);
+        return ((found == end) && other.numberOfCharacters) ? this->numberOfCharacters : found - this->characters;
+    }
+
+    count indexOfFirstOccurenceOf(character other) const
+    {
+        auto found = static_cast<const character*>(::memchr(this->characters, other, this->numberOfCharacters));
+        return found ? found - this->characters : this->numberOfCharacters;
+    }
+
+    // -- Returns a lazy range of views on the parts of this view found between each separator.
+    StringViewSplitter splitBySeparator(character separator) const;
+
+    // -- Copies the characters into a new String.
+    String asString() const;
+
+    std::string asStdString() const
+    {
+        return { this->characters, this->numberOfCharacters };
+    }
+
+    template <typename Char, typename CharTraits>
+    friend inline ::std::basic_ostream<Char, CharTraits>& operator<<(::std::basic_ostream<Char, CharTraits>& os, const StringView& self)
+    {
+        return os.write(self.characters, self.numberOfCharacters);
+    }
+};
+
+// -- Range of the parts of a view found between each separator. Parts are only looked for, with memchr, as the range
+// -- is iterated and never allocate. Like String::splitBySeparator(), an empty view has no parts and a separator at
+// -- the very end doesn't produce an empty last part.
+class StringViewSplitter
+{
+    // -- Private Instance Variables
+    StringView view;
+    character separator;
+
+public:
+    // -- Types
+    class Iterator
+    {
+        // -- Private Instance Variables
+        StringView remaining;
+        StringView part;
+        character separator = 0;
+        boolean isAtEnd = true;
+
+        // -- Private Instance Methods
+        void findNextPart()
+        {
+            if (this->remaining.isEmpty()) {
+                this->isAtEnd = true;
+                return;
+            }
+
+            auto index = this->remaining.indexOfFirstOccurenceOf(this->separator);
+            this->part = this->remaining.subString(0, index);
+            this->remaining = this->remaining.subString(index + 1);
+        }
+
+    public:
+        // -- Types
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = StringView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const StringView*;
+        using reference = const StringView&;
+
+        // -- Constructors/Destructors
+        Iterator() = default;
+        Iterator(StringView withView, character withSeparator) : remaining{ std::move(withView) }, separator{ withSeparator }, isAtEnd{ false }
+        {
+            this->findNextPart();
+        }
+
+        // -- Operators
+        reference operator*() const
+        {
+            return this->part;
+        }
+        pointer operator->() const
+        {
+            return &this->part;
+        }
+        Iterator& operator++()
+        {
+            this->findNextPart();
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            auto result = *this;
+            this->findNextPart();
+            return result;
+        }
+        bool operator==(const Iterator& other) const
+        {
+            if (this->isAtEnd || other.isAtEnd) {
+                return this->isAtEnd == other.isAtEnd;
+            }
+
+            return this->remaining.data() == other.remaining.data() && this->remaining.length() == other.remaining.length();
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return !this->operator==(other);
+        }
+    };
+
+    // -- Constructors/Destructors
+    StringViewSplitter(StringView withView, character withSeparator) : view{ std::move(withView) }, separator{ withSeparator } { }
+
+    // -- Instance Methods
+    Iterator begin() const
+    {
+        return { this->view, this->separator };
+    }
+
+    Iterator end() const
+    {
+        return { };
+    }
+};
+
+inline StringViewSplitter StringView::splitBySeparator(character separator) const
+{
+    return { *this, separator };
+}
+
+}
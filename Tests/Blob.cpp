@@ -22,6 +22,7 @@
 #include "Base/Blob.hpp"
 #include "Base/MutableBlob.hpp"
 #include "Base/String.hpp"
+#include "Base/MutableArray.hpp"
 #include "Base/Test.hpp"
 
 using namespace testing;
@@ -319,6 +320,116 @@ TEST(Base_Blob, base64String_ABlobWithBinaryData_ReturnsTheCorrectBase64String)
     ASSERT_EQ(testBase64String, result);
 }
 
+TEST(Base_Blob, base64String_ABlobWithOneByte_ReturnsAPaddedGroupAndALineEnding)
+{
+    // -- Given.
+    byte data[] = { 0x01 };
+    auto test = Blob::blobWithMemoryAndSize(data, sizeof(data));
+
+    // -- When.
+    auto result = test.base64String();
+
+    // -- Then.
+    ASSERT_STREQ("AQ==\n", result.asUTF8());
+}
+
+TEST(Base_Blob, base64String_ABlobFillingExactlyOneLine_ReturnsTheLineAndTwoLineEndings)
+{
+    // -- Given.
+    auto test = MutableBlob::blobWithCapacity(54);
+
+    // -- When.
+    auto result = test.base64String();
+
+    // -- Then.
+    ASSERT_EQ(String("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA\n\n"), result);
+}
+
+TEST(Base_Blob, blobWithBase64String_AStringWithCharactersOutsideOfTheAlphabet_SkipsTheCharacters)
+{
+    // -- Given.
+    String test("aGVs\r\nbG8*gd29y bGQ=\n");
+
+    // -- When.
+    auto result = Blob::blobWithBase64String(test);
+
+    // -- Then.
+    ASSERT_EQ(11, result.size());
+    ASSERT_EQ(0, ::memcmp(result.data(), "hello world", 11));
+}
+
+TEST(Base_Blob, blobWithBase64String_TheBase64StringOfBlobsOfManySizes_ReturnsTheOriginalBlobs)
+{
+    // -- Given.
+    MutableBlob test;
+
+    for (count size = 1; size < 300; ++size) {
+        test.append(static_cast<character>(size * 7));
+
+        // -- When.
+        auto result = Blob::blobWithBase64String(test.base64String());
+
+        // -- Then.
+        ASSERT_EQ(test.size(), result.size());
+        ASSERT_EQ(0, ::memcmp(result.data(), test.data(), test.size()));
+    }
+}
+
+TEST(Base_Blob, hexString_ABlobWithBinaryData_ReturnsTheLowerCaseDigitsForEachByte)
+{
+    // -- Given.
+    auto test = Blob::blobWithMemoryAndSize(testHash, sizeof(testHash));
+
+    // -- When.
+    auto result = test.hexString();
+
+    // -- Then.
+    ASSERT_STREQ("d276e4ef00a828a9ea51b483a4b6a832", result.asUTF8());
+}
+
+TEST(Base_Blob, description_ABlobWithBinaryData_ReturnsTheHexString)
+{
+    // -- Given.
+    auto test = Blob::blobWithMemoryAndSize(testBinarySourceData, sizeof(testBinarySourceData));
+
+    // -- When.
+    auto result = test.description();
+
+    // -- Then.
+    ASSERT_EQ(test.hexString(), result);
+}
+
+TEST(Base_Blob, blobWithHexString_AStringWithUpperCaseDigitsAndSeparators_SkipsTheSeparators)
+{
+    // -- Given.
+    String test("D2 76 e4 EF:00-a8\n28");
+
+    // -- When.
+    auto result = Blob::blobWithHexString(test);
+
+    // -- Then.
+    ASSERT_EQ(7, result.size());
+    ASSERT_EQ(0, ::memcmp(result.data(), testHash, 7));
+}
+
+TEST(Base_Blob, blobWithHexString_TheHexStringOfBlobsOfManySizes_ReturnsTheOriginalBlobs)
+{
+    // -- Given.
+    MutableBlob test;
+
+    for (count size = 1; size < 100; ++size) {
+        test.append(static_cast<character>(size * 11));
+
+        // -- When.
+        auto result = Blob::blobWithHexString(test.hexString());
+
+        // -- Then.
+        ASSERT_EQ(test.size() * 2, test.hexString().length());
+        ASSERT_EQ(test.size(), result.size());
+        ASSERT_EQ(0, ::memcmp(result.data(), test.data(), test.size()));
+    }
+}
+
 TEST(Base_Blob, Append_AnEmptyBlobAndBlobWithContent_AppendTheContentCorrectly)
 {
     // -- Given.
@@ -451,3 +562,100 @@ TEST(Base_Blob, Append_AnEmptyBlobAndACharacter_AppendsTheCharacter)
     auto data = test.data();
     ASSERT_EQ(data[0], 'G');
 }
+
+TEST(Base_Blob, AppendArrayJoinedWith_ABlobWithContentAndAnArrayOfStrings_AppendsTheJoinedStrings)
+{
+    // -- Given.
+    MutableBlob test;
+    test.append('>');
+    MutableArray<String> strings;
+    strings.append(String("one"));
+    strings.append(String("two"));
+    strings.append(String("three"));
+
+    // -- When.
+    test.appendArrayJoinedWith(strings, StringView{ "\n" });
+
+    // -- Then.
+    ASSERT_EQ(14, test.size());
+    ASSERT_EQ(0, ::memcmp(test.data(), ">one\ntwo\nthree", 14));
+}
+
+TEST(Base_Blob, AppendArrayJoinedWith_ManyAppends_OnlyReallocatesTheMemoryAFewTimes)
+{
+    // -- Given.
+    MutableBlob test;
+    MutableArray<String> strings;
+    strings.append(String("one"));
+    strings.append(String("two"));
+    count numberOfReallocations = 0;
+
+    // -- When.
+    for (count index = 0; index < 1000; ++index) {
+        auto capacity = test.capacity();
+        test.appendArrayJoinedWith(strings, StringView{ "\n" });
+        if (test.capacity() != capacity) {
+            ++numberOfReallocations;
+        }
+    }
+
+    // -- Then.
+    ASSERT_EQ(7000, test.size());
+    ASSERT_GT(20, numberOfReallocations);
+}
+
+TEST(Base_Blob, AppendMemoryWithSize_ABlobWithContent_AppendsTheMemoryAfterTheContent)
+{
+    // -- Given.
+    MutableBlob test;
+    test.append('>');
+
+    // -- When.
+    test.appendMemoryWithSize(testData, sizeof(testData));
+
+    // -- Then.
+    ASSERT_EQ(sizeof(testData) + 1, test.size());
+    ASSERT_EQ('>', test.data()[0]);
+    ASSERT_EQ(0, ::memcmp(test.data() + 1, testData, sizeof(testData)));
+}
+
+TEST(Base_Blob, AppendZerosWithSize_ABlobWithContent_AppendsZerosAfterTheContent)
+{
+    // -- Given.
+    MutableBlob test;
+    test.append('>');
+
+    // -- When.
+    test.appendZerosWithSize(5);
+
+    // -- Then.
+    ASSERT_EQ(6, test.size());
+    ASSERT_EQ(0, ::memcmp(test.data(), ">\0\0\0\0\0", 6));
+}
+
+TEST(Base_Blob, PadToAlignment_ABlobWhichIsNotAligned_AppendsZerosUpToTheAlignment)
+{
+    // -- Given.
+    MutableBlob test;
+    test.appendWithoutStringTermination("hello");
+
+    // -- When.
+    test.padToAlignment(4);
+
+    // -- Then.
+    ASSERT_EQ(8, test.size());
+    ASSERT_EQ(0, ::memcmp(test.data(), "hello\0\0\0", 8));
+}
+
+TEST(Base_Blob, Reserve_ABlobWithContent_LeavesTheContentUnchanged)
+{
+    // -- Given.
+    auto test = MutableBlob::blobWithMemoryAndSize(testData, sizeof(testData));
+
+    // -- When.
+    test.reserve(1024 * 1024);
+
+    // -- Then.
+    ASSERT_EQ(sizeof(testData), test.size());
+    ASSERT_EQ(0, ::memcmp(test.data(), testData, sizeof(testData)));
+}
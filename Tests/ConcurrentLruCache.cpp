@@ -0,0 +1,144 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/ConcurrentLruCache.hpp"
+#include "Base/String.hpp"
+#include "Base/Test.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace NxA;
+
+NXA_CONTAINS_TEST_SUITE_NAMED(Base_ConcurrentLruCache_Tests);
+
+TEST(Base_ConcurrentLruCache, Find_AKeyThatWasInserted_ReturnsACopyOfTheValue)
+{
+    // -- Given.
+    ConcurrentLruCache<String, integer> test;
+    test.resizeCache(64);
+    test.insert(String("one"), 1);
+
+    // -- When.
+    auto result = test.find(String("one"));
+
+    // -- Then.
+    ASSERT_TRUE(result);
+    ASSERT_EQ(1, *result);
+}
+
+TEST(Base_ConcurrentLruCache, Find_AKeyThatWasErased_ReturnsNothing)
+{
+    // -- Given.
+    ConcurrentLruCache<String, integer> test;
+    test.resizeCache(64);
+    test.insert(String("one"), 1);
+
+    // -- When.
+    test.erase(String("one"));
+
+    // -- Then.
+    ASSERT_FALSE(test.find(String("one")));
+    ASSERT_TRUE(test.empty());
+}
+
+TEST(Base_ConcurrentLruCache, ResizeCache_ALimitSmallerThanTheNumberOfShards_EachShardCanStillHoldAnEntry)
+{
+    // -- Given.
+    ConcurrentLruCache<integer, integer> test(8);
+
+    // -- When.
+    test.resizeCache(1);
+    test.insert(3, 30);
+
+    // -- Then.
+    ASSERT_EQ(30, *test.find(3));
+}
+
+TEST(Base_ConcurrentLruCache, Insert_MoreEntriesThanTheLimit_NeverHoldsMoreThanEachShardsShare)
+{
+    // -- Given.
+    ConcurrentLruCache<integer, integer> test(4);
+    test.resizeCache(16);
+
+    // -- When.
+    for (integer key = 0; key < 1000; ++key) {
+        test.insert(key, key);
+    }
+
+    // -- Then.
+    ASSERT_LE(test.size(), 16);
+    ASSERT_EQ(999, *test.find(999));
+}
+
+TEST(Base_ConcurrentLruCache, Insert_SeveralThreadsUsingTheCache_AllValuesFoundAreTheOnesInserted)
+{
+    // -- Given.
+    ConcurrentLruCache<integer, integer> test(16);
+    test.resizeCache(256);
+    std::vector<std::thread> threads;
+
+    // -- When.
+    for (integer threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back([&test, threadIndex]() {
+            for (integer step = 0; step < 20000; ++step) {
+                integer key = (step * 7 + threadIndex) % 512;
+                test.insert(key, key * 2);
+
+                auto found = test.find((key + 3) % 512);
+                if (found) {
+                    ASSERT_EQ(((key + 3) % 512) * 2, *found);
+                }
+            }
+        });
+    }
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    // -- Then.
+    ASSERT_LE(test.size(), 256);
+}
+
+TEST(Base_ConcurrentLruCache, Statistics_LookupsOnSeveralShards_AreSummed)
+{
+    // -- Given.
+    ConcurrentLruCache<integer, integer> test(4);
+    test.setStatisticsEnabled(true);
+    test.resizeCache(64);
+    for (integer key = 0; key < 10; ++key) {
+        test.insert(key, key);
+    }
+
+    // -- When.
+    for (integer key = 0; key < 20; ++key) {
+        test.find(key);
+    }
+
+    // -- Then.
+    auto statistics = test.statistics();
+    ASSERT_EQ(10, statistics.numberOfHits);
+    ASSERT_EQ(10, statistics.numberOfMisses);
+    ASSERT_EQ(10, statistics.numberOfInsertions);
+    ASSERT_EQ(10, statistics.numberOfEntries);
+}
@@ -20,6 +20,7 @@
 //
 
 #include "Base/File.hpp"
+#include "Base/MutableBlob.hpp"
 #include "Base/Test.hpp"
 #include "Base/String.hpp"
 
@@ -79,3 +80,86 @@ TEST(Base_File, joinPaths_TwoPathsAndBothAlreadyHaveASeparator_PathsAreJoinedCor
     // -- Then.
     ASSERT_STREQ("/hello/test", result.asUTF8());
 }
+
+TEST(Base_File, removePrefixFromPath_APrefixWithoutATrailingSeparator_PrefixAndSeparatorAreRemoved)
+{
+    // -- Given.
+    String prefix("/Users/Music");
+    String path("/Users/Music/Artist/Track.mp3");
+
+    // -- When.
+    auto result = File::removePrefixFromPath(prefix, path);
+
+    // -- Then.
+    ASSERT_STREQ("Artist/Track.mp3", result.asUTF8());
+}
+
+TEST(Base_File, removePrefixFromPath_APrefixWithATrailingSeparator_PrefixIsRemoved)
+{
+    // -- Given.
+    String prefix("/Users/Music/");
+    String path("/Users/Music/Artist/Track.mp3");
+
+    // -- When.
+    auto result = File::removePrefixFromPath(prefix, path);
+
+    // -- Then.
+    ASSERT_STREQ("Artist/Track.mp3", result.asUTF8());
+}
+
+TEST(Base_File, writeBase64EncodingOfFileAtToFileAt_AFileEncodedThenDecoded_ReturnsTheOriginalContent)
+{
+    // -- Given.
+    auto content = MutableBlob::blobWithCapacity(1000000);
+    for (count index = 0; index < content.size(); ++index) {
+        content.data()[index] = static_cast<byte>(index * 13);
+    }
+    auto sourcePath = File::joinPaths(File::temporaryDirectoryPath(), String("Base_File_Base64Source"));
+    auto encodedPath = File::joinPaths(File::temporaryDirectoryPath(), String("Base_File_Base64Encoded"));
+    auto decodedPath = File::joinPaths(File::temporaryDirectoryPath(), String("Base_File_Base64Decoded"));
+    File::writeBlobToFileAt(Blob{ content }, sourcePath);
+
+    // -- When.
+    File::writeBase64EncodingOfFileAtToFileAt(sourcePath, encodedPath);
+    File::writeBase64DecodingOfFileAtToFileAt(encodedPath, decodedPath);
+
+    // -- Then.
+    auto encoded = File::readFileAt(encodedPath);
+    ASSERT_EQ(content.base64String(), String::stringWithMemoryAndLength(reinterpret_cast<const character*>(encoded.data()), encoded.size()));
+    auto decoded = File::readFileAt(decodedPath);
+    ASSERT_EQ(content.size(), decoded.size());
+    ASSERT_EQ(0, ::memcmp(decoded.data(), content.data(), content.size()));
+
+    File::deleteFileAt(sourcePath);
+    File::deleteFileAt(encodedPath);
+    File::deleteFileAt(decodedPath);
+}
+
+TEST(Base_File, writeArrayJoinedWithStringToFileAt_AnArrayOfStrings_WritesTheJoinedStrings)
+{
+    // -- Given.
+    Array<String> strings{ String("Artist"), String("Title"), String("Album") };
+    auto path = File::joinPaths(File::temporaryDirectoryPath(), String("Base_File_JoinedStrings"));
+
+    // -- When.
+    File::writeArrayJoinedWithStringToFileAt(strings, String(", "), path);
+
+    // -- Then.
+    auto content = File::readFileAt(path);
+    ASSERT_EQ(String("Artist, Title, Album"),
+              String::stringWithMemoryAndLength(reinterpret_cast<const character*>(content.data()), content.size()));
+
+    File::deleteFileAt(path);
+}
+
+TEST(Base_File, writeArrayJoinedWithStringToFileAt_AFileThatCantBeOpened_ThrowsAnException)
+{
+    // -- Given.
+    Array<String> strings{ String("Artist"), String("Title") };
+    auto path = File::joinPaths(File::joinPaths(File::temporaryDirectoryPath(), String("Base_File_MissingDirectory")),
+                                String("Base_File_JoinedStrings"));
+
+    // -- When.
+    // -- Then.
+    ASSERT_THROW(File::writeArrayJoinedWithStringToFileAt(strings, String(", "), path), FileError);
+}
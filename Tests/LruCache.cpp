@@ -0,0 +1,558 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/LruCache.hpp"
+#include "Base/String.hpp"
+#include "Base/Test.hpp"
+
+#include <list>
+#include <vector>
+
+using namespace testing;
+using namespace NxA;
+
+NXA_CONTAINS_TEST_SUITE_NAMED(Base_LruCache_Tests);
+
+// -- Admits every entry, like the default policy, but counts the accesses it is told about.
+struct CountingAccessesPolicy : LruEvictionPolicy
+{
+    static count numberOfAccesses;
+
+    void recordAccessForHash(uinteger64)
+    {
+        ++CountingAccessesPolicy::numberOfAccesses;
+    }
+};
+
+count CountingAccessesPolicy::numberOfAccesses = 0;
+
+TEST(Base_LruCache, Find_AKeyThatWasInserted_ReturnsTheValue)
+{
+    // -- Given.
+    LruCache<String, integer> test;
+    test.resizeCache(4);
+    test.insert(String("one"), 1);
+    test.insert(String("two"), 2);
+
+    // -- When.
+    auto result = test.find(String("one"));
+
+    // -- Then.
+    ASSERT_NE(test.end(), result);
+    ASSERT_EQ(1, result->second);
+    ASSERT_EQ(2, test.size());
+}
+
+TEST(Base_LruCache, Find_AKeyThatWasNotInserted_ReturnsEnd)
+{
+    // -- Given.
+    LruCache<String, integer> test;
+    test.resizeCache(4);
+    test.insert(String("one"), 1);
+
+    // -- When.
+    auto result = test.find(String("three"));
+
+    // -- Then.
+    ASSERT_EQ(test.end(), result);
+}
+
+TEST(Base_LruCache, Insert_MoreEntriesThanTheLimit_EvictsTheLeastRecentlyUsedEntry)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(2);
+    test.insert(1, 10);
+    test.insert(2, 20);
+
+    // -- When.
+    test.insert(3, 30);
+
+    // -- Then.
+    ASSERT_EQ(2, test.size());
+    ASSERT_EQ(test.end(), test.find(1));
+    ASSERT_NE(test.end(), test.find(2));
+    ASSERT_NE(test.end(), test.find(3));
+}
+
+TEST(Base_LruCache, Find_AnEntryIsFoundBeforeTheCacheOverflows_TheEntryIsPromotedAndNotEvicted)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(2);
+    test.insert(1, 10);
+    test.insert(2, 20);
+
+    // -- When.
+    test.find(1);
+    test.insert(3, 30);
+
+    // -- Then.
+    ASSERT_NE(test.end(), test.find(1));
+    ASSERT_EQ(test.end(), test.find(2));
+}
+
+TEST(Base_LruCache, Insert_AnExistingKey_UpdatesTheValueWithoutGrowing)
+{
+    // -- Given.
+    LruCache<integer, String> test;
+    test.resizeCache(2);
+    test.insert(1, String("first"));
+
+    // -- When.
+    test.insert(1, String("second"));
+
+    // -- Then.
+    ASSERT_EQ(1, test.size());
+    ASSERT_STREQ("second", test.find(1)->second.asUTF8());
+}
+
+TEST(Base_LruCache, Begin_ACacheWithSomeEntries_IteratesFromMostToLeastRecentlyUsed)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(3);
+    test.insert(1, 10);
+    test.insert(2, 20);
+    test.insert(3, 30);
+    test.find(1);
+
+    // -- When.
+    std::vector<integer> keys;
+    for (auto&& entry : test) {
+        keys.push_back(entry.first);
+    }
+
+    // -- Then.
+    ASSERT_EQ((std::vector<integer>{ 1, 3, 2 }), keys);
+}
+
+TEST(Base_LruCache, Erase_AnExistingKey_RemovesTheEntry)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(3);
+    test.insert(1, 10);
+    test.insert(2, 20);
+
+    // -- When.
+    test.erase(1);
+
+    // -- Then.
+    ASSERT_EQ(1, test.size());
+    ASSERT_EQ(test.end(), test.find(1));
+    ASSERT_EQ(20, test.find(2)->second);
+}
+
+TEST(Base_LruCache, ResizeCache_ASmallerLimit_EvictsTheLeastRecentlyUsedEntries)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(4);
+    for (integer key = 0; key < 4; ++key) {
+        test.insert(key, key);
+    }
+
+    // -- When.
+    test.resizeCache(2);
+
+    // -- Then.
+    ASSERT_EQ(2, test.size());
+    ASSERT_EQ(test.end(), test.find(0));
+    ASSERT_EQ(test.end(), test.find(1));
+    ASSERT_NE(test.end(), test.find(2));
+    ASSERT_NE(test.end(), test.find(3));
+}
+
+TEST(Base_LruCache, Clear_ACacheWithEntries_RemovesAllTheEntries)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(4);
+    test.insert(1, 10);
+    test.insert(2, 20);
+
+    // -- When.
+    test.clear();
+
+    // -- Then.
+    ASSERT_TRUE(test.empty());
+    ASSERT_EQ(test.end(), test.find(1));
+    ASSERT_EQ(test.begin(), test.end());
+}
+
+TEST(Base_LruCache, OperatorSquareBrackets_AMissingKey_InsertsADefaultValue)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(4);
+
+    // -- When.
+    test[7] += 3;
+
+    // -- Then.
+    ASSERT_EQ(3, test.find(7)->second);
+}
+
+TEST(Base_LruCache, OperatorSquareBrackets_ACacheThatCantHoldAnyEntry_ReturnsAValueWhichIsNotCached)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+
+    // -- When.
+    test[7] = 3;
+
+    // -- Then.
+    ASSERT_EQ(test.end(), test.find(7));
+    ASSERT_TRUE(test.empty());
+}
+
+TEST(Base_LruCache, OperatorSquareBrackets_AMissingKey_RecordsTheAccessOnlyOnce)
+{
+    // -- Given.
+    LruCache<integer, integer, CountingAccessesPolicy> test;
+    test.resizeCache(4);
+    CountingAccessesPolicy::numberOfAccesses = 0;
+
+    // -- When.
+    test[7] = 3;
+
+    // -- Then.
+    ASSERT_EQ(1, CountingAccessesPolicy::numberOfAccesses);
+    ASSERT_EQ(3, test.find(7)->second);
+}
+
+TEST(Base_LruCache, OperatorSquareBrackets_ManyEntriesInsertedAfterwards_ReturnedReferenceStaysValid)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(1000);
+    auto& value = test[1];
+
+    // -- When.
+    for (integer key = 2; key < 1000; ++key) {
+        test[key] = test[key - 1] + 1;
+    }
+    value = 23;
+
+    // -- Then.
+    ASSERT_EQ(23, test.find(1)->second);
+    ASSERT_EQ(998, test.find(999)->second);
+}
+
+TEST(Base_LruCache, Insert_ManyRandomOperations_BehavesLikeAReferenceList)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(64);
+    std::list<std::pair<integer, integer>> reference;
+    uinteger32 seed = 0x2323;
+
+    // -- When.
+    for (integer step = 0; step < 20000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        integer key = (seed >> 16) % 200;
+        integer operation = (seed >> 8) % 3;
+
+        auto position = std::find_if(reference.begin(), reference.end(), [key](auto&& entry) { return entry.first == key; });
+        if (operation == 0) {
+            test.insert(key, step);
+            if (position != reference.end()) {
+                reference.erase(position);
+            }
+            reference.emplace_front(key, step);
+            if (reference.size() > 64) {
+                reference.pop_back();
+            }
+        }
+        else if (operation == 1) {
+            auto found = test.find(key);
+            ASSERT_EQ(position == reference.end(), found == test.end());
+            if (position != reference.end()) {
+                ASSERT_EQ(position->second, found->second);
+                reference.splice(reference.begin(), reference, position);
+            }
+        }
+        else {
+            test.erase(key);
+            if (position != reference.end()) {
+                reference.erase(position);
+            }
+        }
+    }
+
+    // -- Then.
+    ASSERT_EQ(reference.size(), test.size());
+    auto referencePosition = reference.begin();
+    for (auto&& entry : test) {
+        ASSERT_EQ(referencePosition->first, entry.first);
+        ASSERT_EQ(referencePosition->second, entry.second);
+        ++referencePosition;
+    }
+}
+
+TEST(Base_LruCache, SetMaximumTotalCost_EntriesCostingMoreThanTheBudget_EvictsUntilTheBudgetIsMet)
+{
+    // -- Given.
+    LruCache<integer, String> test;
+    test.resizeCache(100);
+    test.setCostFunction([](const integer&, const String& value) { return value.length(); });
+    test.setMaximumTotalCost(10);
+    test.insert(1, String("aaaa"));
+    test.insert(2, String("bbbb"));
+
+    // -- When.
+    test.insert(3, String("cccc"));
+
+    // -- Then.
+    ASSERT_EQ(2, test.size());
+    ASSERT_EQ(8, test.totalCost());
+    ASSERT_EQ(test.end(), test.find(1));
+}
+
+TEST(Base_LruCache, Insert_AnEntryCostingMoreThanTheWholeBudget_IsNotCachedAndIsHandedToTheEvictionCallback)
+{
+    // -- Given.
+    LruCache<integer, String> test;
+    test.resizeCache(100);
+    test.setCostFunction([](const integer&, const String& value) { return value.length(); });
+    test.setMaximumTotalCost(4);
+    test.insert(1, String("aa"));
+    std::vector<integer> evictedKeys;
+    test.setEvictionCallback([&evictedKeys](const integer& key, const String&) { evictedKeys.push_back(key); });
+
+    // -- When.
+    auto result = test.insert(2, String("too long"));
+
+    // -- Then.
+    ASSERT_EQ(test.end(), result);
+    ASSERT_EQ(1, test.size());
+    ASSERT_EQ((std::vector<integer>{ 2 }), evictedKeys);
+}
+
+TEST(Base_LruCache, SetEvictionCallback_EntriesPushedOutByTheLimit_AreHandedToTheCallbackInLeastRecentlyUsedOrder)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(2);
+    std::vector<std::pair<integer, integer>> evicted;
+    test.setEvictionCallback([&evicted](const integer& key, const integer& value) { evicted.emplace_back(key, value); });
+    test.insert(1, 10);
+    test.insert(2, 20);
+
+    // -- When.
+    test.insert(3, 30);
+    test.resizeCache(0);
+
+    // -- Then.
+    ASSERT_EQ((std::vector<std::pair<integer, integer>>{ { 1, 10 }, { 2, 20 }, { 3, 30 } }), evicted);
+    ASSERT_EQ(0, test.totalCost());
+}
+
+TEST(Base_LruCache, Erase_AnEntryWithACost_TheTotalCostIsReduced)
+{
+    // -- Given.
+    LruCache<integer, String> test;
+    test.resizeCache(100);
+    test.setCostFunction([](const integer&, const String& value) { return value.length(); });
+    test.insert(1, String("aaaa"));
+    test.insert(2, String("bb"));
+
+    // -- When.
+    test.erase(1);
+
+    // -- Then.
+    ASSERT_EQ(2, test.totalCost());
+}
+
+TEST(Base_LruCache, Insert_AOneTimeScanWithTheDefaultPolicy_FlushesTheFrequentlyUsedEntries)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(100);
+    for (integer round = 0; round < 4; ++round) {
+        for (integer key = 0; key < 50; ++key) {
+            test.insert(key, key);
+        }
+    }
+
+    // -- When.
+    for (integer key = 1000; key < 2000; ++key) {
+        test.insert(key, key);
+    }
+
+    // -- Then.
+    for (integer key = 0; key < 50; ++key) {
+        ASSERT_EQ(test.end(), test.find(key));
+    }
+}
+
+TEST(Base_LruCache, Insert_AOneTimeScanWithTheTinyLfuPolicy_KeepsTheFrequentlyUsedEntries)
+{
+    // -- Given.
+    LruCache<integer, integer, TinyLfuAdmissionPolicy> test;
+    test.resizeCache(100);
+    for (integer round = 0; round < 4; ++round) {
+        for (integer key = 0; key < 50; ++key) {
+            test.insert(key, key);
+        }
+    }
+
+    // -- When.
+    for (integer key = 1000; key < 2000; ++key) {
+        test.insert(key, key);
+    }
+
+    // -- Then.
+    for (integer key = 0; key < 50; ++key) {
+        ASSERT_NE(test.end(), test.find(key));
+    }
+    ASSERT_EQ(100, test.size());
+}
+
+TEST(Base_LruCache, FindAndInsert_AOneTimeScanWithTheTinyLfuPolicy_KeepsTheFrequentlyUsedEntries)
+{
+    // -- Given.
+    LruCache<integer, integer, TinyLfuAdmissionPolicy> test;
+    test.resizeCache(100);
+    auto findOrInsert = [&test](integer key) {
+        if (test.find(key) == test.end()) {
+            test.insert(key, key);
+        }
+    };
+    for (integer round = 0; round < 4; ++round) {
+        for (integer key = 0; key < 50; ++key) {
+            findOrInsert(key);
+        }
+    }
+
+    // -- When.
+    for (integer key = 1000; key < 2000; ++key) {
+        findOrInsert(key);
+    }
+
+    // -- Then.
+    for (integer key = 0; key < 50; ++key) {
+        ASSERT_NE(test.end(), test.find(key));
+    }
+}
+
+TEST(Base_LruCache, FindAndInsert_AMissingKey_RecordsTheAccessOnlyOnce)
+{
+    // -- Given.
+    LruCache<integer, integer, CountingAccessesPolicy> test;
+    test.resizeCache(4);
+    CountingAccessesPolicy::numberOfAccesses = 0;
+
+    // -- When.
+    test.find(7);
+    test.insert(7, 3);
+
+    // -- Then.
+    ASSERT_EQ(1, CountingAccessesPolicy::numberOfAccesses);
+}
+
+TEST(Base_LruCache, Insert_ANewKeyAccessedMoreOftenThanTheVictimWithTheTinyLfuPolicy_IsAdmitted)
+{
+    // -- Given.
+    LruCache<integer, integer, TinyLfuAdmissionPolicy> test;
+    test.resizeCache(2);
+    test.insert(1, 10);
+    test.insert(2, 20);
+    test.find(3);
+    test.find(3);
+
+    // -- When.
+    auto result = test.insert(3, 30);
+
+    // -- Then.
+    ASSERT_NE(test.end(), result);
+    ASSERT_EQ(test.end(), test.find(1));
+}
+
+TEST(Base_LruCache, Statistics_StatisticsAreNotEnabled_NothingIsCounted)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.resizeCache(1);
+    test.insert(1, 10);
+    test.insert(2, 20);
+
+    // -- When.
+    test.find(1);
+    test.find(2);
+
+    // -- Then.
+    auto statistics = test.statistics();
+    ASSERT_EQ(0, statistics.numberOfHits);
+    ASSERT_EQ(0, statistics.numberOfMisses);
+    ASSERT_EQ(0, statistics.numberOfInsertions);
+    ASSERT_EQ(0, statistics.numberOfEvictions);
+    ASSERT_EQ(1, statistics.numberOfEntries);
+}
+
+TEST(Base_LruCache, Statistics_SomeLookupsAndEvictions_AreCounted)
+{
+    // -- Given.
+    LruCache<integer, String> test;
+    test.setStatisticsEnabled(true);
+    test.resizeCache(2);
+    test.setCostFunction([](const integer&, const String& value) { return value.length(); });
+
+    // -- When.
+    test.insert(1, String("a"));
+    test.insert(2, String("bb"));
+    test.insert(3, String("ccc"));
+    test.insert(3, String("dddd"));
+    test.find(1);
+    test.find(3);
+    test[4];
+
+    // -- Then.
+    auto statistics = test.statistics();
+    ASSERT_EQ(1, statistics.numberOfHits);
+    ASSERT_EQ(2, statistics.numberOfMisses);
+    ASSERT_EQ(4, statistics.numberOfInsertions);
+    ASSERT_EQ(2, statistics.numberOfEvictions);
+    ASSERT_EQ(0, statistics.numberOfRejections);
+    ASSERT_EQ(3, statistics.totalEvictedCost);
+    ASSERT_EQ(2, statistics.numberOfEntries);
+    ASSERT_EQ(4, statistics.totalCost);
+}
+
+TEST(Base_LruCache, ResetStatistics_SomeLookupsWereCounted_TheCountersAreBackToZero)
+{
+    // -- Given.
+    LruCache<integer, integer> test;
+    test.setStatisticsEnabled(true);
+    test.resizeCache(2);
+    test.insert(1, 10);
+    test.find(1);
+
+    // -- When.
+    test.resetStatistics();
+
+    // -- Then.
+    auto statistics = test.statistics();
+    ASSERT_EQ(0, statistics.numberOfHits);
+    ASSERT_EQ(0, statistics.numberOfInsertions);
+    ASSERT_EQ(1, statistics.numberOfEntries);
+}
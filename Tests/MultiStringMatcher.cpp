@@ -0,0 +1,146 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/MultiStringMatcher.hpp"
+#include "Base/Test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace NxA;
+
+NXA_CONTAINS_TEST_SUITE_NAMED(Base_MultiStringMatcher_Tests);
+
+TEST(Base_MultiStringMatcher, MatchesIn_OverlappingPatterns_ReturnsAllTheMatches)
+{
+    // -- Given.
+    MultiStringMatcher test{ Array<String>{ String("he"), String("she"), String("his"), String("hers") } };
+
+    // -- When.
+    auto result = test.matchesIn(String("ushers"));
+
+    // -- Then.
+    ASSERT_EQ(3, result.length());
+    ASSERT_EQ(1, result[0].patternIndex);
+    ASSERT_EQ(1, result[0].position);
+    ASSERT_EQ(0, result[1].patternIndex);
+    ASSERT_EQ(2, result[1].position);
+    ASSERT_EQ(3, result[2].patternIndex);
+    ASSERT_EQ(2, result[2].position);
+}
+
+TEST(Base_MultiStringMatcher, HasMatchIn_ATextWithoutAnyOfThePatterns_ReturnsFalse)
+{
+    // -- Given.
+    MultiStringMatcher test{ Array<String>{ String("remix"), String("edit"), String("bootleg") } };
+
+    // -- When.
+    // -- Then.
+    ASSERT_FALSE(test.hasMatchIn(String("Track Title (Extended Mix)")));
+    ASSERT_TRUE(test.hasMatchIn(String("Track Title (Radio edit)")));
+}
+
+TEST(Base_MultiStringMatcher, HasMatchIn_NoPatternsOrOnlyAnEmptyOne_ReturnsFalse)
+{
+    // -- Given.
+    MultiStringMatcher test{ Array<String>{ } };
+    MultiStringMatcher testWithAnEmptyPattern{ Array<String>{ String("") } };
+
+    // -- When.
+    // -- Then.
+    ASSERT_FALSE(test.hasMatchIn(String("Title")));
+    ASSERT_FALSE(testWithAnEmptyPattern.hasMatchIn(String("Title")));
+    ASSERT_EQ(1, testWithAnEmptyPattern.numberOfPatterns());
+}
+
+TEST(Base_MultiStringMatcher, MatchesIn_RandomPatternsAndTexts_ReturnsTheSameMatchesAsSearchingForEachPattern)
+{
+    // -- Given.
+    uinteger32 seed = 7;
+    auto nextRandom = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7fff;
+    };
+
+    for (count iteration = 0; iteration < 200; ++iteration) {
+        MutableArray<String> patterns;
+        std::vector<std::string> stdPatterns;
+        auto numberOfPatterns = 1 + (nextRandom() % 20);
+        for (count patternIndex = 0; patternIndex < numberOfPatterns; ++patternIndex) {
+            std::string pattern;
+            auto length = 1 + (nextRandom() % 5);
+            for (count index = 0; index < length; ++index) {
+                pattern += static_cast<character>('a' + (nextRandom() % 3));
+            }
+
+            patterns.append(String(pattern));
+            stdPatterns.push_back(pattern);
+        }
+
+        std::string text;
+        auto length = nextRandom() % 200;
+        for (count index = 0; index < length; ++index) {
+            text += static_cast<character>('a' + (nextRandom() % 4));
+        }
+
+        MultiStringMatcher test{ Array<String>{ std::move(patterns) } };
+
+        // -- When.
+        auto result = test.matchesIn(StringView{ text });
+
+        // -- Then.
+        count expectedNumberOfMatches = 0;
+        for (count patternIndex = 0; patternIndex < stdPatterns.size(); ++patternIndex) {
+            for (auto position = text.find(stdPatterns[patternIndex]); position != std::string::npos;
+                 position = text.find(stdPatterns[patternIndex], position + 1)) {
+                ++expectedNumberOfMatches;
+                ASSERT_TRUE(result.contains(MultiStringMatch{ patternIndex, position }));
+            }
+        }
+
+        ASSERT_EQ(expectedNumberOfMatches, result.length());
+        ASSERT_EQ(expectedNumberOfMatches != 0, test.hasMatchIn(StringView{ text }));
+    }
+}
+
+TEST(Base_MultiStringMatcher, HasMatchIn_SeveralThreadsUsingTheSameMatcher_AllFindTheSameMatches)
+{
+    // -- Given.
+    MultiStringMatcher test{ Array<String>{ String("remix"), String("edit"), String("bootleg") } };
+    std::vector<std::thread> threads;
+
+    // -- When.
+    for (integer threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back([&test]() {
+            for (integer step = 0; step < 10000; ++step) {
+                ASSERT_TRUE(test.hasMatchIn(String("Title (Club remix)")));
+                ASSERT_FALSE(test.hasMatchIn(String("Title (Club mix)")));
+            }
+        });
+    }
+
+    // -- Then.
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+}
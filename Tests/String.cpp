@@ -24,6 +24,7 @@
 #include "Base/MutableString.hpp"
 #include "Base/Test.hpp"
 #include "Base/Array.hpp"
+#include "Base/MutableArray.hpp"
 
 using namespace testing;
 using namespace NxA;
@@ -90,6 +91,125 @@ TEST(Base_String, StringContructorAndToUTF8_StringCreatedFromOtherString_ToUTF8R
     ASSERT_STREQ(utf8String, otherTest.asUTF8());
 }
 
+TEST(Base_String, StringContructorAndToUTF8_CopyOfALongString_SharesTheSameCharacters)
+{
+    // -- Given.
+    String test(utf8String);
+
+    // -- When.
+    auto otherTest = String(test);
+
+    // -- Then.
+    ASSERT_EQ(test.asUTF8(), otherTest.asUTF8());
+}
+
+TEST(Base_String, StringContructorAndToUTF8_CopyOfAShortString_ContainsCorrectValue)
+{
+    // -- Given.
+    String test("mp3");
+
+    // -- When.
+    auto otherTest = test;
+    test = String("wav");
+
+    // -- Then.
+    ASSERT_STREQ("mp3", otherTest.asUTF8());
+    ASSERT_STREQ("wav", test.asUTF8());
+    ASSERT_NE(test.asUTF8(), otherTest.asUTF8());
+}
+
+TEST(Base_String, StringContructorAndToUTF8_StringCreatedFromAShortMutableString_ContainsCorrectValue)
+{
+    // -- Given.
+    MutableString mutableTest("tag");
+    mutableTest.append("s");
+
+    // -- When.
+    String test(std::move(mutableTest));
+
+    // -- Then.
+    ASSERT_STREQ("tags", test.asUTF8());
+    ASSERT_EQ(4, test.length());
+}
+
+TEST(Base_String, OperatorEqual_AssigningShortAndLongStringsToEachOther_ContainsCorrectValues)
+{
+    // -- Given.
+    String shortTest("mp3");
+    String longTest("This is a string long enough to be shared.");
+    String test(shortTest);
+
+    // -- When.
+    test = longTest;
+    auto copyOfTheLongString = test;
+    test = shortTest;
+    auto movedLongString = std::move(copyOfTheLongString);
+
+    // -- Then.
+    ASSERT_STREQ("mp3", test.asUTF8());
+    ASSERT_EQ(3, test.length());
+    ASSERT_TRUE(test == shortTest);
+    ASSERT_STREQ("This is a string long enough to be shared.", movedLongString.asUTF8());
+    ASSERT_TRUE(movedLongString == longTest);
+    ASSERT_EQ(longTest.hash(), movedLongString.hash());
+}
+
+TEST(Base_String, Size_AnyString_IsNotMuchLargerThanASharedPointer)
+{
+    // -- Given.
+    // -- When.
+    // -- Then.
+    ASSERT_LE(sizeof(String), sizeof(std::shared_ptr<MutableString>) + sizeof(count));
+}
+
+TEST(Base_String, InternedString_TwoStringsWithTheSameContent_ReturnsTheSameCanonicalString)
+{
+    // -- Given.
+    String test("Drum & Bass");
+    MutableString other("Drum & ");
+    other.append("Bass");
+
+    // -- When.
+    auto interned = String::internedString(test);
+    auto otherInterned = String::internedString(String(other));
+
+    // -- Then.
+    ASSERT_TRUE(interned.isInterned());
+    ASSERT_FALSE(test.isInterned());
+    ASSERT_EQ(interned.asUTF8(), otherInterned.asUTF8());
+    ASSERT_TRUE(interned == otherInterned);
+    ASSERT_TRUE(interned == test);
+    ASSERT_EQ(test.hash(), interned.hash());
+}
+
+TEST(Base_String, InternedString_TwoStringsWithDifferentContent_AreNotEqual)
+{
+    // -- Given.
+    auto test = String::internedString(String("House"));
+
+    // -- When.
+    auto other = String::internedString(String("Techno"));
+
+    // -- Then.
+    ASSERT_FALSE(test == other);
+    ASSERT_TRUE(test < other);
+    ASSERT_FALSE(other < test);
+}
+
+TEST(Base_String, InternedString_ACopyOfAnInternedString_IsStillInterned)
+{
+    // -- Given.
+    auto test = String::internedString(String("flac"));
+
+    // -- When.
+    auto copy = test;
+    auto otherCopy = String::internedString(copy);
+
+    // -- Then.
+    ASSERT_TRUE(copy.isInterned());
+    ASSERT_EQ(test.asUTF8(), otherCopy.asUTF8());
+}
+
 TEST(Base_String, StringWithUTF16_StringCreatedFromUTF16String_ContainsCorrectValue)
 {
     // -- Given.
@@ -102,6 +222,226 @@ TEST(Base_String, StringWithUTF16_StringCreatedFromUTF16String_ContainsCorrectVa
     ASSERT_STREQ(utf8String, test.asUTF8());
 }
 
+TEST(Base_String, StringWithUTF16_UTF16WithNonASCIICharacters_ContainsCorrectValue)
+{
+    // -- Given.
+    const byte data[] = { 0x00, 0x41, 0x00, 0xe9, 0x65, 0xe5, 0x67, 0x2c, 0xd8, 0x3d, 0xde, 0x00, 0x00, 0x21 };
+    auto blob = Blob::blobWithMemoryAndSize(data, sizeof(data));
+
+    // -- When.
+    auto test = String::stringWithUTF16(blob);
+
+    // -- Then.
+    ASSERT_STREQ("A\xc3\xa9\xe6\x97\xa5\xe6\x9c\xac\xf0\x9f\x98\x80!", test.asUTF8());
+}
+
+TEST(Base_String, StringWithUTF16_LongASCIIText_ContainsCorrectValue)
+{
+    // -- Given.
+    std::string expected("This is a longer piece of ASCII text which is converted in blocks, \xc3\xa9 and then the rest.");
+    auto blob = String(expected).asUTF16();
+
+    // -- When.
+    auto test = String::stringWithUTF16(blob);
+
+    // -- Then.
+    ASSERT_EQ(expected, test.asStdString());
+}
+
+TEST(Base_String, StringWithUTF16_UnpairedSurrogates_AreReplacedByTheReplacementCharacter)
+{
+    // -- Given.
+    const byte data[] = { 0xd8, 0x3d, 0x00, 0x41, 0xde, 0x00, 0xd8, 0x3d };
+    auto blob = Blob::blobWithMemoryAndSize(data, sizeof(data));
+
+    // -- When.
+    auto test = String::stringWithUTF16(blob);
+
+    // -- Then.
+    ASSERT_STREQ("\xef\xbf\xbd" "A" "\xef\xbf\xbd\xef\xbf\xbd", test.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_StringArguments_ReturnsCorrectValue)
+{
+    // -- Given.
+    String first("first");
+    MutableString second("second");
+    std::string third("third");
+
+    // -- When.
+    auto result = String::stringWithFormat("%s, %s, %s and %s.", first, second, third, "fourth");
+
+    // -- Then.
+    ASSERT_STREQ("first, second, third and fourth.", result.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_AFormatWithoutArguments_ReturnsTheFormatUnchanged)
+{
+    // -- Given.
+    String format("50% off");
+
+    // -- When.
+    auto result = String::stringWithFormat("100%");
+    auto otherResult = String::stringWithFormat(format);
+
+    // -- Then.
+    ASSERT_STREQ("100%", result.asUTF8());
+    ASSERT_STREQ("50% off", otherResult.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_AResultLongerThanTheFirstGuess_ReturnsCorrectValue)
+{
+    // -- Given.
+    auto longText = String::stringWithRepeatedCharacter(300, 'a');
+
+    // -- When.
+    auto result = String::stringWithFormat("%s%.3f%0100d", longText, 1.5, 12);
+
+    // -- Then.
+    auto expected = std::string(300, 'a') + "1.500" + std::string(98, '0') + "12";
+    ASSERT_STREQ(expected.c_str(), result.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_NumbersWithFlagsWidthsAndPrecisions_ReturnsTheSameValueAsPrintf)
+{
+    // -- Given.
+    byte value = 0x0a;
+    integer negative = -42;
+    uinteger64 large = 18446744073709551615ull;
+
+    // -- When.
+    auto result = String::stringWithFormat("%02x|%+d|%5d|%-5d|%x|%llu|%6.2f|%*s|%.2s|%c|%%", value, 7, negative, negative, negative,
+                                           large, 3.14159, 4, "ab", "xyz", 'q');
+
+    // -- Then.
+    ASSERT_STREQ("0a|+7|  -42|-42  |ffffffd6|18446744073709551615|  3.14|  ab|xy|q|%", result.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_DecimalAndNumbersGivenToAStringConversion_ReturnsTheirNaturalForm)
+{
+    // -- Given.
+    decimal3 price{ "-12.05" };
+    count length = 12;
+
+    // -- When.
+    auto result = String::stringWithFormat("%s %s %ld %s", price, decimal3{ 3 }, length, -9);
+
+    // -- Then.
+    ASSERT_STREQ("-12.050 3.000 12 -9", result.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_OptionalArguments_ReturnsTheValueOrNothing)
+{
+    // -- Given.
+    NxA::Optional<String> empty;
+    NxA::Optional<String> text{ String("text") };
+    NxA::Optional<integer> number{ 5 };
+
+    // -- When.
+    auto result = String::stringWithFormat("%s %s %d", empty, text, number);
+
+    // -- Then.
+    ASSERT_STREQ("<nothing> text 5", result.asUTF8());
+}
+
+TEST(Base_String, StringWithFormat_AStringGivenToANumericConversion_Asserts)
+{
+    // -- Given.
+    String text("text");
+
+    // -- When.
+    // -- Then.
+    ASSERT_THROW(String::stringWithFormat("%d", text), NxA::AssertionFailed);
+    ASSERT_THROW(String::stringWithFormat("%f", "text"), NxA::AssertionFailed);
+}
+
+TEST(Base_String, StringWithFormat_TooManyOrTooFewArguments_Asserts)
+{
+    // -- Given.
+    // -- When.
+    // -- Then.
+    ASSERT_THROW(String::stringWithFormat("%d %d", 1), NxA::AssertionFailed);
+    ASSERT_THROW(String::stringWithFormat("%d", 1, 2), NxA::AssertionFailed);
+}
+
+TEST(Base_String, AppendStringWithFormat_AMutableStringWithAValue_AppendsTheFormattedText)
+{
+    // -- Given.
+    MutableString test("Values:");
+    auto hashBefore = test.hash();
+
+    // -- When.
+    for (integer value = 0; value < 3; ++value) {
+        test.appendStringWithFormat(" %d=%s", value, String("v"));
+    }
+
+    // -- Then.
+    ASSERT_STREQ("Values: 0=v 1=v 2=v", test.asUTF8());
+    ASSERT_NE(hashBefore, test.hash());
+    ASSERT_EQ(String("Values: 0=v 1=v 2=v").hash(), test.hash());
+}
+
+TEST(Base_String, AppendStringWithFormat_AMutableStringFormattingItself_AppendsTheFormattedText)
+{
+    // -- Given.
+    MutableString test("Self");
+
+    // -- When.
+    test.appendStringWithFormat("[%s]", test);
+    test.appendStringWithFormat("[%s]", test);
+
+    // -- Then.
+    ASSERT_STREQ("Self[Self][Self[Self]]", test.asUTF8());
+}
+
+TEST(Base_String, StringByJoiningArrayWithString_AnArrayOfStrings_ReturnsTheJoinedStrings)
+{
+    // -- Given.
+    MutableArray<String> strings;
+    strings.append(String("one"));
+    strings.append(String::stringWithRepeatedCharacter(40, 't'));
+    strings.append(String(""));
+    strings.append(String("three"));
+
+    // -- When.
+    auto result = String::stringByJoiningArrayWithString(strings, String(", "));
+    auto mutableResult = MutableString::stringByJoiningArrayWithString(strings, String("/"));
+
+    // -- Then.
+    ASSERT_STREQ("one, tttttttttttttttttttttttttttttttttttttttt, , three", result.asUTF8());
+    ASSERT_STREQ("one/tttttttttttttttttttttttttttttttttttttttt//three", mutableResult.asUTF8());
+}
+
+TEST(Base_String, StringByJoiningArrayWithString_AnEmptyArrayOrASingleString_ReturnsAnEmptyStringOrThatString)
+{
+    // -- Given.
+    MutableArray<String> empty;
+    MutableArray<String> single;
+    single.append(String("single"));
+
+    // -- When.
+    // -- Then.
+    ASSERT_TRUE(String::stringByJoiningArrayWithString(empty, String(", ")).isEmpty());
+    ASSERT_STREQ("single", String::stringByJoiningArrayWithString(single, String(", ")).asUTF8());
+}
+
+TEST(Base_String, StringByJoiningArrayWithStringInParallel_ALargeArray_ReturnsTheSameStringAsASingleThread)
+{
+    // -- Given.
+    MutableArray<String> paths;
+    for (integer index = 0; index < 100000; ++index) {
+        paths.append(String::stringWithFormat("/Music/Artist %d/Album %d/Track %d.mp3", index % 97, index % 13, index));
+    }
+
+    // -- When.
+    auto result = String::stringByJoiningArrayWithStringInParallel(paths, String("\n"));
+
+    // -- Then.
+    ASSERT_EQ(String::stringByJoiningArrayWithString(paths, String("\n")), result);
+    ASSERT_TRUE(result.hasPrefix("/Music/Artist 0/Album 0/Track 0.mp3\n/Music/Artist 1/Album 1/Track 1.mp3\n"));
+    ASSERT_TRUE(result.hasPostfix("\n/Music/Artist 89/Album 3/Track 99999.mp3"));
+}
+
 TEST(Base_String, Description_StringWithAValue_ReturnsCorrectValue)
 {
     // -- Given.
@@ -275,6 +615,34 @@ TEST(Base_String, ToUTF16_StringCreatedFromUTF8String_ReturnsCorrectValue)
     ASSERT_EQ(0, ::memcmp(utf16String, result.data(), sizeof(utf16String)));
 }
 
+TEST(Base_String, ToUTF16_StringWithCharactersOutsideTheBasicPlane_ReturnsSurrogatePairs)
+{
+    // -- Given.
+    String test("\xc3\xa9\xf0\x9f\x98\x80");
+
+    // -- When.
+    auto result = test.asUTF16();
+
+    // -- Then.
+    const byte expected[] = { 0x00, 0xe9, 0xd8, 0x3d, 0xde, 0x00 };
+    ASSERT_EQ(sizeof(expected), result.size());
+    ASSERT_EQ(0, ::memcmp(expected, result.data(), sizeof(expected)));
+}
+
+TEST(Base_String, ToUTF16_StringWithInvalidUTF8_ReplacesInvalidSequencesByTheReplacementCharacter)
+{
+    // -- Given.
+    String test("a\xe6\x97" "b\xff");
+
+    // -- When.
+    auto result = test.asUTF16();
+
+    // -- Then.
+    const byte expected[] = { 0x00, 0x61, 0xff, 0xfd, 0x00, 0x62, 0xff, 0xfd };
+    ASSERT_EQ(sizeof(expected), result.size());
+    ASSERT_EQ(0, ::memcmp(expected, result.data(), sizeof(expected)));
+}
+
 TEST(Base_String, Append_AStringToAString_ReturnsCorrectValue)
 {
     // -- Given.
@@ -317,6 +685,22 @@ TEST(Base_String, SplitBySeparator_StringSeparatedBySpacesSpaces_ReturnsCorrectV
     ASSERT_EQ(result[4], "Test.");
 }
 
+TEST(Base_String, SplitBySeparator_StringWithEmptyPartsAndATrailingSeparator_ReturnsCorrectValue)
+{
+    // -- Given.
+    String test(",Hello,,Test.,");
+
+    // -- When.
+    auto result = test.splitBySeparator(',');
+
+    // -- Then.
+    ASSERT_EQ(result.length(), 4);
+    ASSERT_EQ(result[0], "");
+    ASSERT_EQ(result[1], "Hello");
+    ASSERT_EQ(result[2], "");
+    ASSERT_EQ(result[3], "Test.");
+}
+
 TEST(Base_String, Substring_FromAnIndex_ReturnsCorrectValue)
 {
     // -- Given.
@@ -422,6 +806,157 @@ TEST(Base_String, Substring_FromAnIndexAndToAnotherInInverserOrderTheEndOfTheStr
     ASSERT_THROW(test.subString(244, 25), NxA::AssertionFailed);
 }
 
+TEST(Base_String, StringWithUTF8_AComposedStringThatNeedsNormalizing_ReturnsTheDecomposedString)
+{
+    // -- Given.
+    auto composed = "Beyonc\xc3\xa9 - D\xc3\xa9j\xc3\xa0 Vu";
+
+    // -- When.
+    auto result = String::stringWithUTF8(composed, String::UTF8Flag::NeedsNormalizing);
+
+    // -- Then.
+    ASSERT_STREQ("Beyonce\xcc\x81 - De\xcc\x81ja\xcc\x80 Vu", result.asUTF8());
+}
+
+TEST(Base_String, StringWithUTF8_ALatin1StringWithoutDecompositions_ReturnsTheSameString)
+{
+    // -- Given.
+    auto text = "\xc3\x86r\xc3\xb8sk\xc3\xb8" "bing \xc2\xbd Stra\xc3\x9f" "e";
+
+    // -- When.
+    auto result = String::stringWithUTF8(text, String::UTF8Flag::NeedsNormalizing);
+
+    // -- Then.
+    ASSERT_STREQ(text, result.asUTF8());
+}
+
+TEST(Base_String, StringWithUTF8_AStringWithCombiningMarksInTheWrongOrder_ReordersThem)
+{
+    // -- Given.
+    // -- U+0301 has a higher combining class than U+0323 so it must come after it.
+    auto text = "a\xcc\x81\xcc\xa3";
+
+    // -- When.
+    auto result = String::stringWithUTF8(text, String::UTF8Flag::NeedsNormalizing);
+
+    // -- Then.
+    ASSERT_STREQ("a\xcc\xa3\xcc\x81", result.asUTF8());
+}
+
+TEST(Base_String, StringsByNormalizingStringsInParallel_ManyStrings_ReturnsTheStringsInNormalizedForm)
+{
+    // -- Given.
+    MutableArray<String> strings;
+    for (integer index = 0; index < 5000; ++index) {
+        if (index % 3) {
+            strings.append(String::stringWithFormat("/Users/someone/Music/Beyonc\xc3\xa9/D\xc3\xa9j\xc3\xa0 Vu %d.mp3", index));
+        }
+        else {
+            strings.append(String::stringWithFormat("/Users/someone/Music/Track %d.mp3", index));
+        }
+    }
+
+    // -- When.
+    auto result = String::stringsByNormalizingStringsInParallel(Array<String>{ strings });
+
+    // -- Then.
+    ASSERT_EQ(strings.length(), result.length());
+    for (count index = 0; index < result.length(); ++index) {
+        ASSERT_EQ(String::stringWithUTF8(strings[index].asUTF8(), String::UTF8Flag::NeedsNormalizing), result[index]);
+    }
+    ASSERT_EQ(String::stringWithFormat("/Users/someone/Music/Beyonce\xcc\x81/De\xcc\x81ja\xcc\x80 Vu %d.mp3", 1), result[1]);
+    ASSERT_EQ(strings[0], result[0]);
+}
+
+TEST(Base_String, CompareNormalized_AComposedAndADecomposedString_ReturnsZero)
+{
+    // -- Given.
+    String composed("Beyonc\xc3\xa9 - D\xc3\xa9j\xc3\xa0 Vu");
+    String decomposed("Beyonce\xcc\x81 - De\xcc\x81ja\xcc\x80 Vu");
+
+    // -- When.
+    auto result = composed.compareNormalized(decomposed);
+
+    // -- Then.
+    ASSERT_EQ(0, result);
+    ASSERT_NE(0, composed.compare(decomposed));
+}
+
+TEST(Base_String, CompareNormalized_StringsWithDifferentCases_ReturnsTheSameOrderAsCompare)
+{
+    // -- Given.
+    String test("Track Title");
+    String other("track title");
+
+    // -- When.
+    auto result = test.compareNormalized(other);
+
+    // -- Then.
+    ASSERT_EQ(-1, result);
+    ASSERT_EQ(1, other.compareNormalized(test));
+}
+
+TEST(Base_String, CompareCaseInsensitive_StringsOnlyDifferentByTheirCaseAndNormalization_ReturnsZero)
+{
+    // -- Given.
+    String test("BEYONCE\xcc\x81 - STRASSE");
+    String other("beyonc\xc3\xa9 - stra\xc3\x9f" "e");
+
+    // -- When.
+    auto result = test.compareCaseInsensitive(other);
+
+    // -- Then.
+    ASSERT_EQ(0, result);
+}
+
+TEST(Base_String, CompareCaseInsensitive_DifferentStrings_ReturnsTheirOrder)
+{
+    // -- Given.
+    String test("ABC");
+    String longer("abcd");
+    String different("\xc3\x89t\xc3\xa9");
+    String otherDifferent("\xc3\xa9tz");
+
+    // -- When.
+    // -- Then.
+    ASSERT_EQ(-1, test.compareCaseInsensitive(longer));
+    ASSERT_EQ(1, longer.compareCaseInsensitive(test));
+    ASSERT_EQ(1, test.compareCaseInsensitive(String("ABB")));
+    ASSERT_EQ(-1, different.compareCaseInsensitive(otherDifferent));
+}
+
+TEST(Base_String, CaseInsensitiveSortKey_SeveralStrings_SortInTheSameOrderAsCompareCaseInsensitive)
+{
+    // -- Given.
+    Array<String> strings{ String("Beyonc\xc3\xa9"), String("BEYONCE"), String("beyonce\xcc\x81s"), String("\xc3\x89t\xc3\xa9"),
+                           String("ETE"), String("stra\xc3\x9f" "e"), String("Strasse"), String(""), String("zzz"), String("\xe6\x97\xa5\xe6\x9c\xac") };
+
+    // -- When.
+    // -- Then.
+    for (auto&& first : strings) {
+        for (auto&& second : strings) {
+            ASSERT_EQ(first.compareCaseInsensitive(second), first.caseInsensitiveSortKey().compare(second.caseInsensitiveSortKey()));
+            ASSERT_EQ(first.compareNormalized(second), first.sortKey().compare(second.sortKey()));
+        }
+    }
+}
+
+TEST(Base_String, CaseInsensitiveSortKey_TwoStringsOnlyDifferentByTheirCase_ReturnsEqualKeys)
+{
+    // -- Given.
+    String test("Stra\xc3\x9f" "e");
+    String other("STRASSE");
+
+    // -- When.
+    auto key = test.caseInsensitiveSortKey();
+    auto otherKey = other.caseInsensitiveSortKey();
+
+    // -- Then.
+    ASSERT_EQ(key, otherKey);
+    ASSERT_EQ(7, key.length());
+    ASSERT_EQ(0, ::memcmp(key.data(), "strasse", key.length()));
+}
+
 TEST(Base_String, LowerCaseString_StringWithUpperCaseCharacters_ReturnsOneWithLowerCaseUTFCharacters)
 {
     // -- Given.
@@ -446,6 +981,87 @@ TEST(Base_String, UpperCaseString_StringWithLowerCaseCharacters_ReturnsOneWithUp
     ASSERT_STREQ("MP3 GRÜSSENSS", result.asUTF8());
 }
 
+TEST(Base_String, LowerCaseString_ALongASCIIString_ReturnsOneWithOnlyTheLettersConverted)
+{
+    // -- Given.
+    String test("THE Quick BROWN fox [JUMPS] @ over THE lazy DOG 0123456789 `~{}|\\");
+
+    // -- When.
+    auto result = test.lowerCaseString();
+
+    // -- Then.
+    ASSERT_STREQ("the quick brown fox [jumps] @ over the lazy dog 0123456789 `~{}|\\", result.asUTF8());
+}
+
+TEST(Base_String, UpperCaseString_ALongASCIIString_ReturnsOneWithOnlyTheLettersConverted)
+{
+    // -- Given.
+    String test("THE Quick BROWN fox [JUMPS] @ over THE lazy DOG 0123456789 `~{}|\\");
+
+    // -- When.
+    auto result = test.upperCaseString();
+
+    // -- Then.
+    ASSERT_STREQ("THE QUICK BROWN FOX [JUMPS] @ OVER THE LAZY DOG 0123456789 `~{}|\\", result.asUTF8());
+}
+
+TEST(Base_String, LowerCaseString_NonASCIICharactersBetweenLongASCIIRuns_ReturnsOneWithLowerCaseUTFCharacters)
+{
+    // -- Given.
+    String test("SOME LONG ASCII PREFIX ÉTÉ AND A LONG ASCII RUN BEFORE GRÜSSEN AND ÀÉÎ AND A LONG ASCII SUFFIX");
+
+    // -- When.
+    auto result = test.lowerCaseString();
+
+    // -- Then.
+    ASSERT_STREQ("some long ascii prefix été and a long ascii run before grüssen and àéî and a long ascii suffix", result.asUTF8());
+}
+
+TEST(Base_String, LowerCaseString_AGreekCapitalSigmaNextToASCIICharacters_ReturnsOneWithTheCorrectSigmaForm)
+{
+    // -- Given.
+    String endOfWord("A LONG ASCII PREFIX ΟΔΟΣ AND A LONG ASCII SUFFIX");
+    String afterAnASCIILetter("A LONG ASCII PREFIXΣ");
+    String beforeAnASCIILetter("ΣA LONG ASCII SUFFIX");
+
+    // -- When.
+    auto endOfWordResult = endOfWord.lowerCaseString();
+    auto afterAnASCIILetterResult = afterAnASCIILetter.lowerCaseString();
+    auto beforeAnASCIILetterResult = beforeAnASCIILetter.lowerCaseString();
+
+    // -- Then.
+    ASSERT_STREQ("a long ascii prefix οδος and a long ascii suffix", endOfWordResult.asUTF8());
+    ASSERT_STREQ("a long ascii prefixς", afterAnASCIILetterResult.asUTF8());
+    ASSERT_STREQ("σa long ascii suffix", beforeAnASCIILetterResult.asUTF8());
+}
+
+TEST(Base_String, ConvertToLowerCase_AnASCIIString_ConvertsTheStringInPlace)
+{
+    // -- Given.
+    MutableString test("Mp3 FILES ON THE DESKTOP");
+    auto hashBefore = test.hash();
+
+    // -- When.
+    test.convertToLowerCase();
+
+    // -- Then.
+    ASSERT_STREQ("mp3 files on the desktop", test.asUTF8());
+    ASSERT_NE(hashBefore, test.hash());
+    ASSERT_EQ(String("mp3 files on the desktop").hash(), test.hash());
+}
+
+TEST(Base_String, ConvertToUpperCase_AStringWithNonASCIICharacters_ConvertsTheString)
+{
+    // -- Given.
+    MutableString test("Mp3 grüßENß");
+
+    // -- When.
+    test.convertToUpperCase();
+
+    // -- Then.
+    ASSERT_STREQ("MP3 GRÜSSENSS", test.asUTF8());
+}
+
 TEST(Base_String, HasPrefix_StringWithAGivenPrefix_ReturnsTrue)
 {
     // -- Given.
@@ -508,6 +1124,18 @@ TEST(Base_String, HasPostfix_StringWithoutAGivenPostfix_ReturnsFalse)
     ASSERT_FALSE(test.hasPostfix("Test2"));
 }
 
+TEST(Base_String, HasPostfix_StringWhereThePostfixAlsoAppearsEarlier_ReturnsTrue)
+{
+    // -- Given.
+    String test("Test. Hello This Is A Test.");
+    String test2("Test.");
+
+    // -- When.
+    // -- Then.
+    ASSERT_TRUE(test.hasPostfix(test2));
+    ASSERT_TRUE(test.hasPostfix("Test."));
+}
+
 TEST(Base_String, HasPostfix_StringWithAGivenPostfixAndAStringWithThatPostfix_ReturnsTrue)
 {
     // -- Given.
@@ -635,6 +1263,66 @@ TEST(Base_String, HashFor_ConstCharacterPointerAndStringPointer_AreEqual)
     ASSERT_EQ(String::hashFor(testPtr), testStr.hash());
 }
 
+TEST(Base_String, Hash_CalledTwiceOnTheSameString_ReturnsTheSameValue)
+{
+    // -- Given.
+    String test(utf8String);
+
+    // -- When.
+    auto first = test.hash();
+    auto second = test.hash();
+
+    // -- Then.
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(String::hashFor(utf8String), second);
+}
+
+TEST(Base_String, Hash_AMutableStringModifiedAfterItsHashWasComputed_ReturnsTheHashOfTheNewContent)
+{
+    // -- Given.
+    MutableString test("Hello");
+    test.hash();
+
+    // -- When.
+    test.append(" World");
+    auto afterAppend = test.hash();
+    test.replaceOccurenceOfStringWith("World", "There");
+    auto afterReplace = test.hash();
+
+    // -- Then.
+    ASSERT_EQ(String::hashFor("Hello World"), afterAppend);
+    ASSERT_EQ(String::hashFor("Hello There"), afterReplace);
+}
+
+TEST(Base_String, Hash64For_ConstCharacterPointerAndStringWithLength_AreEqual)
+{
+    // -- Given.
+    String test(utf8String);
+
+    // -- When.
+    // -- Then.
+    ASSERT_EQ(String::hash64For(utf8String), test.hash64());
+    ASSERT_EQ(String::hash64For(utf8String, String::lengthOf(utf8String)), test.hash64());
+}
+
+TEST(Base_String, Hash64For_StringsOfAllLengthsDifferingByOneCharacter_ReturnDifferentValues)
+{
+    // -- Given.
+    character buffer[128];
+    ::memset(buffer, 'a', sizeof(buffer));
+
+    // -- When.
+    // -- Then.
+    for (count length = 1; length < sizeof(buffer); ++length) {
+        auto hash = String::hash64For(buffer, length);
+        ASSERT_NE(String::hash64For(buffer, length - 1), hash);
+
+        buffer[length - 1] = 'b';
+        ASSERT_NE(String::hash64For(buffer, length), hash);
+        buffer[length - 1] = 'a';
+    }
+}
+
 TEST(Base_String, IntegerValue_AStringWithAnInteger_ReturnsCorrectValue)
 {
     // -- Given.
@@ -674,3 +1362,92 @@ TEST(Base_String, IntegerValue_AStringWithAInvalidString_ReturnsZero)
     // -- Then.
     ASSERT_EQ(testStr.integerValue(), 0);
 }
+
+TEST(Base_String, IsValidUTF8_ValidSequencesAtEveryOffset_ReturnsTrue)
+{
+    // -- Given.
+    const std::string sequences[] = { "\xc2\x80", "\xdf\xbf", "\xe0\xa0\x80", "\xed\x9f\xbf", "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf4\x8f\xbf\xbf" };
+
+    for (auto&& sequence : sequences) {
+        for (count offset = 0; offset < 70; ++offset) {
+            // -- When.
+            String test(std::string(offset, 'a') + sequence + std::string(70 - offset, 'b'));
+
+            // -- Then.
+            ASSERT_TRUE(test.isValidUTF8());
+        }
+    }
+}
+
+TEST(Base_String, IsValidUTF8_InvalidSequencesAtEveryOffset_ReturnsFalse)
+{
+    // -- Given.
+    const std::string sequences[] = { "\x80", "\xbf", "\xc0\xaf", "\xc1\xbf", "\xc2", "\xc2\x41", "\xe0\x9f\xbf", "\xed\xa0\x80", "\xe1\x80",
+                                      "\xe1\x80\x41", "\xf0\x8f\xbf\xbf", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf1\x80\x80", "\xff" };
+
+    for (auto&& sequence : sequences) {
+        for (count offset = 0; offset < 70; ++offset) {
+            // -- When.
+            String test(std::string(offset, 'a') + sequence + std::string(70 - offset, 'b'));
+            String truncated(std::string(offset, 'a') + sequence);
+
+            // -- Then.
+            ASSERT_FALSE(test.isValidUTF8());
+            ASSERT_FALSE(truncated.isValidUTF8());
+        }
+    }
+}
+
+TEST(Base_String, IsValidUTF8_AnEmptyString_ReturnsTrue)
+{
+    // -- Given.
+    String test;
+
+    // -- When.
+    // -- Then.
+    ASSERT_TRUE(test.isValidUTF8());
+}
+
+TEST(Base_String, HasNonPrintableCharacters_AControlCharacterAtEveryOffset_ReturnsTrue)
+{
+    for (count offset = 0; offset < 70; ++offset) {
+        // -- Given.
+        String test(std::string(offset, 'a') + '\x01' + std::string(70 - offset, '\xc3'));
+        String deleteCharacter(std::string(offset, 'a') + '\x7f');
+
+        // -- When.
+        // -- Then.
+        ASSERT_TRUE(test.hasNonPrintableCharacters());
+        ASSERT_TRUE(deleteCharacter.hasNonPrintableCharacters());
+    }
+}
+
+TEST(Base_String, HasNonPrintableCharacters_ALongStringWithTabsAndNewLines_ReturnsFalse)
+{
+    // -- Given.
+    String test(std::string(100, 'a') + "\t\r\n" + "caf\xc3\xa9" + std::string(100, ' '));
+
+    // -- When.
+    // -- Then.
+    ASSERT_FALSE(test.hasNonPrintableCharacters());
+}
+
+TEST(Base_String, StringByFilteringNonPrintableCharactersIn_ALongStringWithControlCharacters_RemovesOnlyThoseCharacters)
+{
+    // -- Given.
+    std::string text;
+    std::string expected;
+    for (count index = 0; index < 200; ++index) {
+        character value = static_cast<character>(index);
+        text += value;
+        if (((index > 0x1f) || (index == 0x09) || (index == 0x0a) || (index == 0x0d)) && (index != 0x7f)) {
+            expected += value;
+        }
+    }
+
+    // -- When.
+    auto result = String::stringByFilteringNonPrintableCharactersIn(String(text));
+
+    // -- Then.
+    ASSERT_EQ(String(expected), result);
+}
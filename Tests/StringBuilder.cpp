@@ -0,0 +1,159 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/StringBuilder.hpp"
+#include "Base/String.hpp"
+#include "Base/MutableString.hpp"
+#include "Base/Array.hpp"
+#include "Base/MutableArray.hpp"
+#include "Base/Describe.hpp"
+#include "Base/Test.hpp"
+
+#include <string>
+
+using namespace testing;
+using namespace NxA;
+
+NXA_CONTAINS_TEST_SUITE_NAMED(Base_StringBuilder_Tests);
+
+TEST(Base_StringBuilder, AsString_AnEmptyBuilder_ReturnsAnEmptyString)
+{
+    // -- Given.
+    StringBuilder test;
+
+    // -- When.
+    auto result = test.asString();
+
+    // -- Then.
+    ASSERT_TRUE(test.isEmpty());
+    ASSERT_TRUE(result.isEmpty());
+}
+
+TEST(Base_StringBuilder, Append_DifferentKindsOfText_ReturnsThemInOrder)
+{
+    // -- Given.
+    StringBuilder test;
+
+    // -- When.
+    test.append("one");
+    test.append(' ');
+    test.append(String("two"));
+    test.append(StringView{ " three" });
+    test.append(MutableString(" four"));
+    test.appendRepeatedCharacter(3, '!');
+    test.appendStringWithFormat(" %d%s", 5, String("th"));
+
+    // -- Then.
+    ASSERT_EQ(25, test.length());
+    ASSERT_STREQ("one two three four!!! 5th", test.asString().asUTF8());
+}
+
+TEST(Base_StringBuilder, Append_LongStringsAndManyShortPieces_ReturnsEverythingInOrder)
+{
+    // -- Given.
+    StringBuilder test;
+    std::string expected;
+    auto longString = String::stringWithRepeatedCharacter(1000, 'x');
+
+    // -- When.
+    for (integer index = 0; index < 2000; ++index) {
+        auto piece = String::stringWithFormat("%d,", index);
+        test.append(piece);
+        expected.append(piece.asUTF8());
+
+        if ((index % 500) == 0) {
+            test.append(longString);
+            expected.append(longString.asUTF8());
+        }
+    }
+
+    // -- Then.
+    ASSERT_EQ(expected.length(), test.length());
+    ASSERT_STREQ(expected.c_str(), test.asString().asUTF8());
+    ASSERT_STREQ(expected.c_str(), test.asMutableString().asUTF8());
+}
+
+TEST(Base_StringBuilder, Append_AMutableStringModifiedAfterwards_ReturnsTheOriginalCharacters)
+{
+    // -- Given.
+    StringBuilder test;
+    MutableString text(String::stringWithRepeatedCharacter(300, 'a'));
+
+    // -- When.
+    test.append(text);
+    text.append("b");
+
+    // -- Then.
+    ASSERT_EQ(300, test.length());
+    ASSERT_EQ(String::stringWithRepeatedCharacter(300, 'a'), test.asString());
+}
+
+TEST(Base_StringBuilder, Reserve_ALargeHint_AppendsStillReturnTheRightCharacters)
+{
+    // -- Given.
+    StringBuilder test{ 10000 };
+
+    // -- When.
+    for (integer index = 0; index < 1000; ++index) {
+        test.append("0123456789");
+    }
+
+    // -- Then.
+    ASSERT_EQ(10000, test.length());
+    ASSERT_TRUE(test.asString().hasPostfix("0123456789"));
+}
+
+TEST(Base_StringBuilder, AppendArrayJoinedWith_AnArrayOfStrings_ReturnsTheJoinedStrings)
+{
+    // -- Given.
+    MutableArray<String> strings;
+    strings.append(String("one"));
+    strings.append(String("two"));
+    strings.append(String("three"));
+    StringBuilder test;
+
+    // -- When.
+    test.appendArrayJoinedWith(strings, StringView{ ", " });
+
+    // -- Then.
+    ASSERT_STREQ("one, two, three", test.asString().asUTF8());
+}
+
+TEST(Base_StringBuilder, Describe_AnArrayOfArrays_ReturnsTheIndentedDescription)
+{
+    // -- Given.
+    MutableArray<integer> inner;
+    inner.append(1);
+    inner.append(2);
+    MutableArray<MutableArray<integer>> test;
+    test.append(inner);
+
+    // -- When.
+    auto result = describe(test);
+
+    // -- Then.
+    ASSERT_STREQ("    <MutableArray length=\"1\">\n"
+                 "        <MutableArray length=\"2\">\n"
+                 "12"
+                 "        </MutableArray>\n"
+                 "    </MutableArray>\n",
+                 result.asUTF8());
+}
@@ -0,0 +1,121 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/StringSearcher.hpp"
+#include "Base/String.hpp"
+#include "Base/Test.hpp"
+
+#include <string>
+
+using namespace testing;
+using namespace NxA;
+
+NXA_CONTAINS_TEST_SUITE_NAMED(Base_StringSearcher_Tests);
+
+TEST(Base_StringSearcher, IndexOfFirstOccurenceIn_AShortNeedleInSeveralHaystacks_ReturnsTheIndexInEachOne)
+{
+    // -- Given.
+    StringSearcher test{ StringView{ "mix" } };
+
+    // -- When.
+    // -- Then.
+    ASSERT_EQ(22, test.indexOfFirstOccurenceIn(StringView{ "Track Title (Extended mix) mix" }));
+    ASSERT_EQ(0, test.indexOfFirstOccurenceIn(StringView{ "mix" }));
+    ASSERT_EQ(3, test.indexOfFirstOccurenceIn(StringView{ "Mix" }));
+    ASSERT_EQ(2, test.indexOfFirstOccurenceIn(StringView{ "mi" }));
+}
+
+TEST(Base_StringSearcher, IndexOfFirstOccurenceIn_AnEmptyNeedle_ReturnsZero)
+{
+    // -- Given.
+    StringSearcher test{ StringView{ } };
+
+    // -- When.
+    // -- Then.
+    ASSERT_EQ(0, test.indexOfFirstOccurenceIn(StringView{ "Title" }));
+    ASSERT_EQ(0, test.indexOfFirstOccurenceIn(StringView{ }));
+}
+
+TEST(Base_StringSearcher, IndexOfFirstOccurenceIn_ANeedleAtEveryOffsetOfALongHaystack_ReturnsThatOffset)
+{
+    for (count needleLength = 1; needleLength < 80; needleLength += 7) {
+        // -- Given.
+        std::string needle;
+        for (count index = 0; index < needleLength; ++index) {
+            needle += static_cast<character>('a' + (index % 3));
+        }
+
+        StringSearcher test{ StringView{ needle } };
+
+        for (count offset = 0; offset < 100; ++offset) {
+            auto haystack = std::string(offset, 'a') + needle + std::string(50, 'b');
+
+            // -- When.
+            auto result = test.indexOfFirstOccurenceIn(StringView{ haystack });
+
+            // -- Then.
+            ASSERT_EQ(haystack.find(needle), result);
+        }
+    }
+}
+
+TEST(Base_StringSearcher, IndexOfFirstOccurenceIn_NeedlesOnRepetitiveHaystacks_ReturnsTheSameIndexAsStdFind)
+{
+    // -- Given.
+    uinteger32 seed = 1;
+    auto nextRandom = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7fff;
+    };
+
+    for (count iteration = 0; iteration < 20000; ++iteration) {
+        std::string haystack;
+        auto haystackLength = nextRandom() % 300;
+        for (count index = 0; index < haystackLength; ++index) {
+            haystack += static_cast<character>('a' + (nextRandom() % 2));
+        }
+
+        std::string needle;
+        auto needleLength = 1 + (nextRandom() % 70);
+        for (count index = 0; index < needleLength; ++index) {
+            needle += static_cast<character>('a' + (nextRandom() % 2));
+        }
+
+        // -- When.
+        auto result = StringSearcher{ StringView{ needle } }.indexOfFirstOccurenceIn(StringView{ haystack });
+
+        // -- Then.
+        auto expected = haystack.find(needle);
+        ASSERT_EQ((expected == std::string::npos) ? haystack.length() : expected, result);
+    }
+}
+
+TEST(Base_StringSearcher, IsFoundIn_ALongNeedleNotInTheHaystack_ReturnsFalse)
+{
+    // -- Given.
+    String needle("This is a long needle which is longer than thirty two characters.");
+    StringSearcher test{ needle.asStringView() };
+
+    // -- When.
+    // -- Then.
+    ASSERT_FALSE(test.isFoundIn(StringView{ "This is a long needle which is longer than thirty two characters!" }));
+    ASSERT_TRUE(test.isFoundIn(StringView{ "Found: This is a long needle which is longer than thirty two characters." }));
+}
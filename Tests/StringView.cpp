@@ -0,0 +1,211 @@
+//
+//  Copyright (c) 2015-2017 Next Audio Labs, LLC. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+
+#include "Base/StringView.hpp"
+#include "Base/String.hpp"
+#include "Base/Test.hpp"
+
+#include <vector>
+
+using namespace testing;
+using namespace NxA;
+
+NXA_CONTAINS_TEST_SUITE_NAMED(Base_StringView_Tests);
+
+TEST(Base_StringView, AsStringView_AString_PointsToTheCharactersOfTheString)
+{
+    // -- Given.
+    String test("A path/that/is/longer/than/an/inline/string");
+
+    // -- When.
+    auto result = test.asStringView();
+
+    // -- Then.
+    ASSERT_EQ(test.asUTF8(), result.data());
+    ASSERT_EQ(test.length(), result.length());
+    ASSERT_FALSE(result.isPinned());
+}
+
+TEST(Base_StringView, SubStringView_AStartAndEnd_ReturnsAViewOnTheSameCharacters)
+{
+    // -- Given.
+    String test("/Music/Artist/Album/Track.mp3");
+
+    // -- When.
+    auto result = test.subStringView(7, 13);
+
+    // -- Then.
+    ASSERT_EQ(test.asUTF8() + 7, result.data());
+    ASSERT_TRUE(result == "Artist");
+    ASSERT_STREQ("Artist", result.asString().asUTF8());
+}
+
+TEST(Base_StringView, SubString_AStartPastTheEnd_ReturnsAnEmptyView)
+{
+    // -- Given.
+    StringView test("Track.mp3");
+
+    // -- When.
+    auto result = test.subString(20);
+
+    // -- Then.
+    ASSERT_TRUE(result.isEmpty());
+    ASSERT_STREQ("", String(result).asUTF8());
+}
+
+TEST(Base_StringView, AsPinnedStringView_TheOriginalStringIsDestroyed_TheViewIsStillValid)
+{
+    // -- Given.
+    StringView longResult;
+    StringView shortResult;
+
+    // -- When.
+    {
+        String longTest("A path/that/is/longer/than/an/inline/string");
+        String shortTest("mp3");
+        longResult = longTest.asPinnedStringView().subString(7);
+        shortResult = shortTest.asPinnedStringView();
+    }
+
+    // -- Then.
+    ASSERT_TRUE(longResult.isPinned());
+    ASSERT_TRUE(longResult == "that/is/longer/than/an/inline/string");
+    ASSERT_TRUE(shortResult == "mp3");
+}
+
+TEST(Base_StringView, HasPrefixAndHasPostfix_AViewAndSomeStrings_ReturnsTheCorrectValue)
+{
+    // -- Given.
+    StringView test("Track.mp3");
+
+    // -- When.
+    // -- Then.
+    ASSERT_TRUE(test.hasPrefix("Track"));
+    ASSERT_FALSE(test.hasPrefix("mp3"));
+    ASSERT_TRUE(test.hasPostfix(".mp3"));
+    ASSERT_FALSE(test.hasPostfix("Track"));
+    ASSERT_FALSE(test.hasPostfix("A longer Track.mp3"));
+}
+
+TEST(Base_StringView, IndexOfFirstAndLastOccurenceOf_AViewWithRepeatedStrings_ReturnsTheCorrectIndices)
+{
+    // -- Given.
+    StringView test("abcabcabc");
+
+    // -- When.
+    // -- Then.
+    ASSERT_EQ(1, test.indexOfFirstOccurenceOf("bc"));
+    ASSERT_EQ(7, test.indexOfLastOccurenceOf("bc"));
+    ASSERT_EQ(9, test.indexOfFirstOccurenceOf("x"));
+    ASSERT_EQ(2, test.indexOfFirstOccurenceOf('c'));
+    ASSERT_TRUE(test.contains("cab"));
+    ASSERT_FALSE(test.contains("cc"));
+}
+
+TEST(Base_StringView, Contains_AnEmptyString_ReturnsTrue)
+{
+    // -- Given.
+    StringView test("abc");
+    StringView emptyTest("");
+
+    // -- When.
+    // -- Then.
+    ASSERT_TRUE(test.contains(""));
+    ASSERT_TRUE(emptyTest.contains(""));
+    ASSERT_TRUE(String("").contains(String("")));
+    ASSERT_TRUE(String("").contains(""));
+}
+
+TEST(Base_StringView, Compare_TwoViews_OrdersThemLikeStrings)
+{
+    // -- Given.
+    StringView test("abc");
+
+    // -- When.
+    // -- Then.
+    ASSERT_EQ(0, test.compare("abc"));
+    ASSERT_LT(test.compare("abd"), 0);
+    ASSERT_LT(test.compare("abcd"), 0);
+    ASSERT_GT(test.compare("ab"), 0);
+    ASSERT_TRUE(StringView("ab") < test);
+}
+
+TEST(Base_StringView, Hash_AViewAndAStringWithTheSameContent_ReturnTheSameHash)
+{
+    // -- Given.
+    String test("Some/Path/To/A/File.flac");
+
+    // -- When.
+    auto view = test.subStringView(0, 9);
+
+    // -- Then.
+    ASSERT_EQ(String("Some/Path").hash(), view.hash());
+    ASSERT_EQ(String("Some/Path").hash64(), view.hash64());
+}
+
+TEST(Base_StringView, SplitBySeparator_AViewWithSeparators_ReturnsViewsOnEachPart)
+{
+    // -- Given.
+    String test("Artist;Title;;Genre");
+    std::vector<StringView> parts;
+
+    // -- When.
+    for (auto&& part : test.splitViewsBySeparator(';')) {
+        parts.push_back(part);
+    }
+
+    // -- Then.
+    ASSERT_EQ(4, parts.size());
+    ASSERT_TRUE(parts[0] == "Artist");
+    ASSERT_EQ(test.asUTF8(), parts[0].data());
+    ASSERT_TRUE(parts[1] == "Title");
+    ASSERT_TRUE(parts[2].isEmpty());
+    ASSERT_TRUE(parts[3] == "Genre");
+}
+
+TEST(Base_StringView, SplitBySeparator_AViewEndingWithASeparator_DoesNotReturnAnEmptyLastPart)
+{
+    // -- Given.
+    StringView test(",a,");
+    std::vector<StringView> parts;
+
+    // -- When.
+    for (auto&& part : test.splitBySeparator(',')) {
+        parts.push_back(part);
+    }
+
+    // -- Then.
+    ASSERT_EQ(2, parts.size());
+    ASSERT_TRUE(parts[0].isEmpty());
+    ASSERT_TRUE(parts[1] == "a");
+}
+
+TEST(Base_StringView, SplitBySeparator_AnEmptyView_ReturnsNoParts)
+{
+    // -- Given.
+    StringView test;
+
+    // -- When.
+    auto result = test.splitBySeparator(',');
+
+    // -- Then.
+    ASSERT_TRUE(result.begin() == result.end());
+}
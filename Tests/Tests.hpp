@@ -26,9 +26,16 @@
 // -- This forces the linker to link the object files where these tests
 // -- are defined. Otherwise they would get stripped out.
 NXA_USING_TEST_SUITE_NAMED(Base_String_Tests);
+NXA_USING_TEST_SUITE_NAMED(Base_StringView_Tests);
+NXA_USING_TEST_SUITE_NAMED(Base_StringBuilder_Tests);
+NXA_USING_TEST_SUITE_NAMED(Base_StringSearcher_Tests);
+NXA_USING_TEST_SUITE_NAMED(Base_MultiStringMatcher_Tests);
 NXA_USING_TEST_SUITE_NAMED(Base_Blob_Tests);
 NXA_USING_TEST_SUITE_NAMED(Base_Array_Tests);
 NXA_USING_TEST_SUITE_NAMED(Base_Map_Tests);
 NXA_USING_TEST_SUITE_NAMED(Base_Set_Tests);
+NXA_USING_TEST_SUITE_NAMED(Base_LruCache_Tests);
+NXA_USING_TEST_SUITE_NAMED(Base_ConcurrentLruCache_Tests);
 
-NXA_USE_TEST_SUITES_FOR_MODULE(Base){Base_String_Tests, Base_Blob_Tests, Base_Set_Tests, Base_Array_Tests, Base_Map_Tests};
+NXA_USE_TEST_SUITES_FOR_MODULE(Base){Base_String_Tests, Base_StringView_Tests, Base_StringBuilder_Tests, Base_StringSearcher_Tests, Base_MultiStringMatcher_Tests, Base_Blob_Tests,
+                                 Base_Set_Tests, Base_Array_Tests, Base_Map_Tests, Base_LruCache_Tests, Base_ConcurrentLruCache_Tests};